@@ -0,0 +1,401 @@
+#include "../3rdParty/doctest.h"
+#include "Benchmark.hpp"
+#include "../Include/Graph.hpp"
+#include "../Include/GraphSnapshot.hpp"
+#include "../Include/GraphAlgorithms.hpp"
+#include <random>
+#include <cmath>
+
+namespace
+{
+	// Random graph with all the weights equal to 1, so weighted and unweighted runs give the same results
+	void createRandomGraph(Graph& graph, int nodesCount, int edgesCount)
+	{
+		std::mt19937 generator{ 1 };
+		std::uniform_int_distribution<int> nodeDistribution{ 1, nodesCount };
+
+		graph.createNodes(nodesCount);
+		std::vector<Edge> edges;
+		edges.reserve(edgesCount);
+		for (int i{ 0 }; i < edgesCount; ++i) {
+			edges.push_back(Edge{ nodeDistribution(generator), nodeDistribution(generator), 1 });
+		}
+		graph.addEdges(std::move(edges));
+		for (const Edge& edge : graph.buildUndirectedEdges()) {
+			graph.setEdgeWeight(edge.a, edge.b, 1, Directed::No);
+		}
+	}
+
+	// Random graph with weights in range [1, maxWeight]
+	void createRandomWeightedGraph(Graph& graph, int nodesCount, int edgesCount, int maxWeight)
+	{
+		std::mt19937 generator{ 1 };
+		std::uniform_int_distribution<int> nodeDistribution{ 1, nodesCount };
+		std::uniform_int_distribution<int> weightDistribution{ 1, maxWeight };
+
+		graph.createNodes(nodesCount);
+		graph.makeWeighted();
+		std::vector<Edge> edges;
+		edges.reserve(edgesCount);
+		for (int i{ 0 }; i < edgesCount; ++i) {
+			edges.push_back(Edge{ nodeDistribution(generator), nodeDistribution(generator), weightDistribution(generator) });
+		}
+		graph.addEdges(std::move(edges));
+		for (const Edge& edge : graph.buildUndirectedEdges()) {
+			graph.setEdgeWeight(edge.a, edge.b, weightDistribution(generator), Directed::No);
+		}
+	}
+
+	// Road like grid graph with random weights in range [1, maxWeight], node ids go row by row
+	void createGridGraph(Graph& graph, int side, int maxWeight)
+	{
+		std::mt19937 generator{ 1 };
+		std::uniform_int_distribution<int> weightDistribution{ 1, maxWeight };
+
+		graph.createNodes(side * side);
+		graph.makeWeighted();
+		std::vector<Edge> edges;
+		for (int row{ 0 }; row < side; ++row) {
+			for (int column{ 0 }; column < side; ++column) {
+				const int node{ row * side + column + 1 };
+				if (column + 1 < side) {
+					edges.push_back(Edge{ node, node + 1 });
+				}
+				if (row + 1 < side) {
+					edges.push_back(Edge{ node, node + side });
+				}
+			}
+		}
+		graph.addEdges(std::move(edges));
+		for (const Edge& edge : graph.buildUndirectedEdges()) {
+			graph.setEdgeWeight(edge.a, edge.b, weightDistribution(generator), Directed::No);
+		}
+	}
+
+	// Random graph with power-law like degrees, edges end in nodes with small ids much more often
+	void createPowerLawGraph(Graph& graph, int nodesCount, int edgesCount)
+	{
+		std::mt19937 generator{ 1 };
+		std::uniform_int_distribution<int> nodeDistribution{ 1, nodesCount };
+		std::uniform_real_distribution<double> skewDistribution{ 0.0, 1.0 };
+
+		graph.createNodes(nodesCount);
+		std::vector<Edge> edges;
+		edges.reserve(edgesCount);
+		for (int i{ 0 }; i < edgesCount; ++i) {
+			const int hub{ 1 + static_cast<int>((nodesCount - 1) * std::pow(skewDistribution(generator), 4.0)) };
+			edges.push_back(Edge{ nodeDistribution(generator), hub });
+		}
+		graph.addEdges(std::move(edges));
+	}
+}
+
+TEST_SUITE("Benchmarks" * doctest::skip()) {
+	TEST_CASE("Unweighted kernels vs weighted kernels with unit weights") {
+		Graph graph;
+		createRandomGraph(graph, 200000, 1000000);
+
+		const GraphSnapshot unweightedSnapshot{ graph };
+		graph.makeWeighted();
+		const GraphSnapshot weightedSnapshot{ graph };
+
+		GraphAlgorithms::TraversalOrder weightedResult;
+		const double weightedDijkstraTime{ Benchmark::measure([&]() {
+			weightedResult = GraphAlgorithms::dijkstra(weightedSnapshot, 1, 2);
+		}) };
+		GraphAlgorithms::TraversalOrder unweightedResult;
+		const double unweightedDijkstraTime{ Benchmark::measure([&]() {
+			unweightedResult = GraphAlgorithms::dijkstra(unweightedSnapshot, 1, 2);
+		}) };
+		CHECK(weightedResult.nodeOrder == unweightedResult.nodeOrder);
+		Benchmark::report("dijkstra, weighted kernel, 200k nodes, 1M edges", weightedDijkstraTime);
+		Benchmark::reportSpeedup("dijkstra, unweighted kernel, 200k nodes, 1M edges", weightedDijkstraTime, unweightedDijkstraTime);
+
+		const double weightedKruskalTime{ Benchmark::measure([&]() {
+			weightedResult = GraphAlgorithms::kruskalMST(weightedSnapshot);
+		}) };
+		const double unweightedKruskalTime{ Benchmark::measure([&]() {
+			unweightedResult = GraphAlgorithms::kruskalMST(unweightedSnapshot);
+		}) };
+		CHECK(weightedResult.edgeOrder == unweightedResult.edgeOrder);
+		Benchmark::report("kruskalMST, weighted kernel, 200k nodes, 1M edges", weightedKruskalTime);
+		Benchmark::reportSpeedup("kruskalMST, unweighted kernel, 200k nodes, 1M edges", weightedKruskalTime, unweightedKruskalTime);
+	}
+
+	TEST_CASE("Sequential BFS vs direction optimizing parallel BFS") {
+		Graph graph;
+		createPowerLawGraph(graph, 200000, 1600000);
+		const GraphSnapshot snapshot{ graph };
+
+		GraphAlgorithms::TraversalOrder sequentialResult;
+		const double sequentialTime{ Benchmark::measure([&]() {
+			sequentialResult = GraphAlgorithms::bfs(snapshot, 1);
+		}) };
+		GraphAlgorithms::TraversalOrder parallelResult;
+		const double parallelTime{ Benchmark::measure([&]() {
+			parallelResult = GraphAlgorithms::bfs(snapshot, 1, ExecutionPolicy::Parallel);
+		}) };
+
+		CHECK(sequentialResult.nodeOrder.size() == parallelResult.nodeOrder.size());
+		Benchmark::report("bfs, sequential, 200k nodes, 1.6M edges", sequentialTime);
+		Benchmark::reportSpeedup("bfs, parallel with " + std::to_string(Parallel::getThreadsCount()) + " threads, 200k nodes, 1.6M edges", sequentialTime, parallelTime);
+	}
+
+	TEST_CASE("Dijkstra with binary heap vs bucket queue") {
+		Graph graph;
+		createRandomWeightedGraph(graph, 200000, 1000000, 99);
+		// Path to an isolated node is never found, so the whole graph is searched
+		const int isolatedNode{ graph.createNode() };
+		const GraphSnapshot snapshot{ graph };
+
+		GraphAlgorithms::TraversalOrder heapResult;
+		const double heapTime{ Benchmark::measure([&]() {
+			heapResult = GraphAlgorithms::dijkstra(snapshot, 1, isolatedNode, GraphAlgorithms::ShortestPathQueue::BinaryHeap);
+		}) };
+		GraphAlgorithms::TraversalOrder bucketResult;
+		const double bucketTime{ Benchmark::measure([&]() {
+			bucketResult = GraphAlgorithms::dijkstra(snapshot, 1, isolatedNode, GraphAlgorithms::ShortestPathQueue::BucketQueue);
+		}) };
+
+		CHECK(heapResult.nodeOrder.empty());
+		CHECK(bucketResult.nodeOrder.empty());
+		Benchmark::report("dijkstra, binary heap, weights 1-99, 200k nodes, 1M edges", heapTime);
+		Benchmark::reportSpeedup("dijkstra, bucket queue, weights 1-99, 200k nodes, 1M edges", heapTime, bucketTime);
+	}
+
+	TEST_CASE("Dijkstra vs bidirectional Dijkstra") {
+		const int side{ 500 };
+		Graph graph;
+		createGridGraph(graph, side, 99);
+		const GraphSnapshot snapshot{ graph };
+
+		// Both nodes are in the middle row, a quarter of the side away from its ends
+		const int startNode{ side / 2 * side + side / 4 };
+		const int endNode{ side / 2 * side + side * 3 / 4 };
+
+		GraphAlgorithms::TraversalOrder dijkstraResult;
+		const double dijkstraTime{ Benchmark::measure([&]() {
+			dijkstraResult = GraphAlgorithms::dijkstra(snapshot, startNode, endNode, GraphAlgorithms::ShortestPathQueue::BinaryHeap);
+		}) };
+		GraphAlgorithms::TraversalOrder bidirectionalResult;
+		const double bidirectionalTime{ Benchmark::measure([&]() {
+			bidirectionalResult = GraphAlgorithms::bidirectionalDijkstra(snapshot, startNode, endNode);
+		}) };
+
+		CHECK(bidirectionalResult.nodeOrder.back() == dijkstraResult.nodeOrder.back());
+		Benchmark::report("dijkstra, binary heap, 500x500 grid", dijkstraTime);
+		Benchmark::reportSpeedup("bidirectional dijkstra, 500x500 grid", dijkstraTime, bidirectionalTime);
+	}
+
+	TEST_CASE("Dijkstra vs A*") {
+		// Grid edges are 10 units long and weights are in range [10, 20], so the weights follow the distances
+		const int side{ 500 };
+		Graph graph;
+		createGridGraph(graph, side, 11);
+		for (const Edge& edge : graph.buildUndirectedEdges()) {
+			graph.setEdgeWeight(edge.a, edge.b, edge.weight + 9, Directed::No);
+		}
+		const GraphSnapshot snapshot{ graph };
+		const GraphAlgorithms::PositionLookup getPosition{ [side](int nodeId) {
+			return std::pair{ 10.f * ((nodeId - 1) % side), 10.f * ((nodeId - 1) / side) };
+		} };
+
+		const int startNode{ side / 2 * side + side / 4 };
+		const int endNode{ side / 2 * side + side * 3 / 4 };
+
+		GraphAlgorithms::SearchStatistics dijkstraStatistics;
+		GraphAlgorithms::TraversalOrder dijkstraResult;
+		const double dijkstraTime{ Benchmark::measure([&]() {
+			dijkstraResult = GraphAlgorithms::dijkstra(snapshot, startNode, endNode, GraphAlgorithms::ShortestPathQueue::BinaryHeap, &dijkstraStatistics);
+		}) };
+		GraphAlgorithms::SearchStatistics aStarStatistics;
+		GraphAlgorithms::TraversalOrder aStarResult;
+		const double aStarTime{ Benchmark::measure([&]() {
+			aStarResult = GraphAlgorithms::aStar(snapshot, startNode, endNode, getPosition, &aStarStatistics);
+		}) };
+
+		CHECK(aStarResult.nodeOrder.back() == dijkstraResult.nodeOrder.back());
+		Benchmark::report("dijkstra, binary heap, 500x500 grid, " + std::to_string(dijkstraStatistics.expandedNodesCount) + " expanded nodes", dijkstraTime);
+		Benchmark::reportSpeedup("a*, 500x500 grid, " + std::to_string(aStarStatistics.expandedNodesCount) + " expanded nodes", dijkstraTime, aStarTime);
+	}
+
+	TEST_CASE("Dijkstra vs delta-stepping scaling") {
+		Graph graph;
+		createRandomWeightedGraph(graph, 200000, 1000000, 99);
+		const GraphSnapshot snapshot{ graph };
+
+		GraphAlgorithms::ShortestPaths sequentialResult;
+		const double sequentialTime{ Benchmark::measure([&]() {
+			sequentialResult = GraphAlgorithms::shortestPaths(snapshot, 1);
+		}) };
+		Benchmark::report("shortest paths, dijkstra, 200k nodes, 1M edges", sequentialTime);
+
+		for (const int threadsCount : { 1, 2, 4, 8, 16 }) {
+			Parallel::setThreadsCount(threadsCount);
+			GraphAlgorithms::ShortestPaths parallelResult;
+			const double parallelTime{ Benchmark::measure([&]() {
+				parallelResult = GraphAlgorithms::shortestPaths(snapshot, 1, ExecutionPolicy::Parallel);
+			}) };
+			CHECK(parallelResult.distances == sequentialResult.distances);
+			Benchmark::reportSpeedup("shortest paths, delta-stepping with " + std::to_string(threadsCount) + " threads, 200k nodes, 1M edges", sequentialTime, parallelTime);
+		}
+		Parallel::setThreadsCount(0);
+	}
+
+	TEST_CASE("Dijkstra from every node vs blocked Floyd-Warshall") {
+		const int nodesCount{ 1024 };
+		Graph graph;
+		createRandomWeightedGraph(graph, nodesCount, nodesCount * 8, 99);
+		const GraphSnapshot snapshot{ graph };
+
+		const double dijkstraTime{ Benchmark::measure([&]() {
+			for (int node{ 1 }; node <= nodesCount; ++node) {
+				GraphAlgorithms::shortestPaths(snapshot, node);
+			}
+		}, 1) };
+		GraphAlgorithms::DistanceMatrix sequentialResult;
+		const double sequentialTime{ Benchmark::measure([&]() {
+			sequentialResult = GraphAlgorithms::allPairsShortestPaths(snapshot);
+		}, 1) };
+		GraphAlgorithms::DistanceMatrix parallelResult;
+		const double parallelTime{ Benchmark::measure([&]() {
+			parallelResult = GraphAlgorithms::allPairsShortestPaths(snapshot, ExecutionPolicy::Parallel);
+		}, 1) };
+
+		CHECK(parallelResult.intDistances == sequentialResult.intDistances);
+		Benchmark::report("all pairs shortest paths, dijkstra from every node, 1024 nodes, 8k edges", dijkstraTime);
+		Benchmark::reportSpeedup("all pairs shortest paths, floyd-warshall, 1024 nodes, 8k edges", dijkstraTime, sequentialTime);
+		Benchmark::reportSpeedup("all pairs shortest paths, floyd-warshall with " + std::to_string(Parallel::getThreadsCount()) + " threads, 1024 nodes, 8k edges", dijkstraTime, parallelTime);
+	}
+
+	TEST_CASE("Kruskal vs parallel Boruvka") {
+		Graph graph;
+		createRandomWeightedGraph(graph, 200000, 1000000, 99);
+		const GraphSnapshot snapshot{ graph };
+
+		GraphAlgorithms::TraversalOrder kruskalResult;
+		const double kruskalTime{ Benchmark::measure([&]() {
+			kruskalResult = GraphAlgorithms::kruskalMST(snapshot);
+		}) };
+		GraphAlgorithms::TraversalOrder boruvkaResult;
+		const double boruvkaTime{ Benchmark::measure([&]() {
+			boruvkaResult = GraphAlgorithms::boruvkaMST(snapshot);
+		}) };
+
+		CHECK(boruvkaResult.edgeOrder == kruskalResult.edgeOrder);
+		Benchmark::report("kruskalMST, counting sort, weights 1-99, 200k nodes, 1M edges", kruskalTime);
+		Benchmark::reportSpeedup("boruvkaMST with " + std::to_string(Parallel::getThreadsCount()) + " threads, weights 1-99, 200k nodes, 1M edges", kruskalTime, boruvkaTime);
+	}
+
+	TEST_CASE("Kruskal vs Prim") {
+		// Counting sort keeps kruskalMST ahead on the editor's weights even at 256 edges per node,
+		// Prim's algorithm wins only on dense graphs with a wide range of weights
+		for (const int edgesPerNode : { 4, 16, 64, 256 }) {
+			for (const int maxWeight : { 99, 1000000 }) {
+				Graph graph;
+				createRandomWeightedGraph(graph, 1000000 / edgesPerNode, 1000000, maxWeight);
+				const GraphSnapshot snapshot{ graph };
+
+				const double kruskalTime{ Benchmark::measure([&]() { GraphAlgorithms::kruskalMST(snapshot); }) };
+				const double primTime{ Benchmark::measure([&]() { GraphAlgorithms::primMST(snapshot); }) };
+
+				const std::string graphName{ std::to_string(edgesPerNode) + " edges per node, weights 1-" + std::to_string(maxWeight) + ", 1M edges" };
+				Benchmark::report("kruskalMST, " + graphName, kruskalTime);
+				Benchmark::reportSpeedup("primMST, " + graphName, kruskalTime, primTime);
+			}
+		}
+	}
+
+	TEST_CASE("Connected components") {
+		Graph graph;
+		createRandomGraph(graph, 1000000, 2000000);
+		const GraphSnapshot snapshot{ graph };
+
+		const double sequentialTime{ Benchmark::measure([&]() {
+			GraphAlgorithms::connectedComponents(snapshot, ExecutionPolicy::Sequential);
+		}) };
+		const double parallelTime{ Benchmark::measure([&]() {
+			GraphAlgorithms::connectedComponents(snapshot, ExecutionPolicy::Parallel);
+		}) };
+		const double findIslandsTime{ Benchmark::measure([&]() {
+			GraphAlgorithms::findIslands(snapshot);
+		}) };
+
+		Benchmark::report("connected components, 1M nodes, 2M edges", sequentialTime);
+		Benchmark::reportSpeedup("connected components with " + std::to_string(Parallel::getThreadsCount()) + " threads, 1M nodes, 2M edges", sequentialTime, parallelTime);
+		Benchmark::report("findIslands, 1M nodes, 2M edges", findIslandsTime);
+	}
+
+	TEST_CASE("Islands while adding edges") {
+		// Editing session: an edge is added before every query
+		constexpr int queriesCount{ 20 };
+		Graph graph;
+		createRandomGraph(graph, 100000, 100000);
+		std::mt19937 generator{ 2 };
+		std::uniform_int_distribution<int> nodeDistribution{ 1, 100000 };
+
+		const double snapshotTime{ Benchmark::measure([&]() {
+			for (int i{ 0 }; i < queriesCount; ++i) {
+				graph.addEdge(nodeDistribution(generator), nodeDistribution(generator));
+				GraphAlgorithms::findIslands(*graph.snapshot());
+			}
+		}, 1) };
+		const double sameComponentTime{ Benchmark::measure([&]() {
+			for (int i{ 0 }; i < queriesCount; ++i) {
+				graph.addEdge(nodeDistribution(generator), nodeDistribution(generator));
+				graph.sameComponent(nodeDistribution(generator), nodeDistribution(generator));
+			}
+		}, 1) };
+
+		Benchmark::report("findIslands on new snapshots, 20 edges added, 100k nodes", snapshotTime);
+		Benchmark::reportSpeedup("sameComponent, 20 edges added, 100k nodes", snapshotTime, sameComponentTime);
+	}
+
+	TEST_CASE("Coloring strategies") {
+		Graph graph;
+		createRandomGraph(graph, 200000, 1000000);
+		const GraphSnapshot snapshot{ graph };
+
+		for (const auto& [strategy, name] : { std::pair{ GraphAlgorithms::ColoringStrategy::Greedy, "greedy" },
+			std::pair{ GraphAlgorithms::ColoringStrategy::SmallestLast, "smallest last" }, std::pair{ GraphAlgorithms::ColoringStrategy::DSatur, "dsatur" },
+			std::pair{ GraphAlgorithms::ColoringStrategy::JonesPlassmann, "jones-plassmann" } }) {
+			GraphAlgorithms::NodesColorsIdxs nodesColorsIdxs;
+			const double time{ Benchmark::measure([&]() {
+				nodesColorsIdxs = GraphAlgorithms::coloring(snapshot, strategy).second;
+			}) };
+
+			int colorsCount{ 0 };
+			for (const auto& [nodeId, colorIdx] : nodesColorsIdxs) {
+				colorsCount = std::max(colorsCount, *colorIdx + 1);
+			}
+			Benchmark::report(std::string{ "coloring, " } + name + ", " + std::to_string(colorsCount) + " colors, 200k nodes, 1M edges", time);
+		}
+	}
+
+	TEST_CASE("Parallel Jones-Plassmann coloring") {
+		Graph graph;
+		createRandomGraph(graph, 1000000, 5000000);
+		const GraphSnapshot snapshot{ graph };
+
+		GraphAlgorithms::NodesColorsIdxs nodesColorsIdxs;
+		const double greedyTime{ Benchmark::measure([&]() {
+			nodesColorsIdxs = GraphAlgorithms::coloring(snapshot).second;
+		}, 1) };
+		for (const int threadsCount : { 1, 2, 4, 8 }) {
+			Parallel::setThreadsCount(threadsCount);
+			const double time{ Benchmark::measure([&]() {
+				nodesColorsIdxs = GraphAlgorithms::coloring(snapshot, GraphAlgorithms::ColoringStrategy::JonesPlassmann).second;
+			}, 1) };
+			Benchmark::reportSpeedup("jones-plassmann coloring with " + std::to_string(threadsCount) + " threads, 1M nodes, 5M edges", greedyTime, time);
+		}
+		Parallel::setThreadsCount(0);
+
+		bool isValid{ false };
+		const double validationTime{ Benchmark::measure([&]() {
+			isValid = GraphAlgorithms::isColoringValid(snapshot, nodesColorsIdxs);
+		}, 1) };
+		CHECK(isValid);
+		Benchmark::report("greedy coloring, 1M nodes, 5M edges", greedyTime);
+		Benchmark::report("coloring validation, 1M nodes, 5M edges", validationTime);
+	}
+}
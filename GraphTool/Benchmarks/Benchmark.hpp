@@ -0,0 +1,36 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <limits>
+
+// Benchmarks are doctest test cases in the "Benchmarks" suite, which is skipped by default.
+// Run them with "--no-skip --test-suite=Benchmarks --exit", from a release build with GRAPHTOOL_BENCHMARKS defined to get meaningful numbers.
+namespace Benchmark
+{
+	// Returns the best time of the given number of runs in milliseconds
+	template<typename Function>
+	double measure(Function&& function, int runs = 5)
+	{
+		double bestTime{ std::numeric_limits<double>::max() };
+		for (int i{ 0 }; i < runs; ++i) {
+			const auto start{ std::chrono::steady_clock::now() };
+			function();
+			const auto end{ std::chrono::steady_clock::now() };
+			bestTime = std::min(bestTime, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+		return bestTime;
+	}
+
+	inline void report(const std::string& name, double milliseconds)
+	{
+		std::cout << "[benchmark] " << name << ": " << milliseconds << " ms\n";
+	}
+
+	inline void reportSpeedup(const std::string& name, double baselineMilliseconds, double milliseconds)
+	{
+		std::cout << "[benchmark] " << name << ": " << milliseconds << " ms (" << baselineMilliseconds / milliseconds << "x)\n";
+	}
+}
@@ -0,0 +1,65 @@
+#include "../3rdParty/doctest.h"
+#include "Benchmark.hpp"
+#include "../Include/Graph.hpp"
+#include "../Include/EdgeIndex.hpp"
+#include <random>
+
+TEST_SUITE("Benchmarks" * doctest::skip()) {
+	TEST_CASE("Edge lookups: std::set vs EdgeIndex") {
+		const int nodesCount{ 100000 };
+		const int edgesCount{ 1000000 };
+		const int queriesCount{ 4000000 };
+
+		std::mt19937 generator{ 1 };
+		std::uniform_int_distribution<int> nodeDistribution{ 1, nodesCount };
+
+		std::set<Edge> edgesSet;
+		EdgeIndex<int> edgesIndex;
+		edgesIndex.reserve(edgesCount);
+		std::vector<Edge> edges;
+		while (edges.size() < edgesCount) {
+			const Edge edge{ nodeDistribution(generator), nodeDistribution(generator), static_cast<int>(edges.size() % 100) };
+			if (edgesSet.insert(edge).second) {
+				edgesIndex.insert(edge.a, edge.b, edge.weight);
+				edges.push_back(edge);
+			}
+		}
+
+		// Half of the queries hit existing edges
+		std::vector<std::pair<int, int>> queries;
+		queries.reserve(queriesCount);
+		for (int i{ 0 }; i < queriesCount; ++i) {
+			if (i % 2 == 0) {
+				const Edge& edge{ edges[generator() % edges.size()] };
+				queries.push_back({ edge.a, edge.b });
+			}
+			else {
+				queries.push_back({ nodeDistribution(generator), nodeDistribution(generator) });
+			}
+		}
+
+		long long setWeightsSum{ 0 };
+		const double setTime{ Benchmark::measure([&]() {
+			setWeightsSum = 0;
+			for (const auto& [a, b] : queries) {
+				if (const auto it{ edgesSet.find(Edge{ a, b }) }; it != edgesSet.end()) {
+					setWeightsSum += it->weight;
+				}
+			}
+		}) };
+
+		long long indexWeightsSum{ 0 };
+		const double indexTime{ Benchmark::measure([&]() {
+			indexWeightsSum = 0;
+			for (const auto& [a, b] : queries) {
+				if (const int* weight{ edgesIndex.find(a, b) }) {
+					indexWeightsSum += *weight;
+				}
+			}
+		}) };
+
+		CHECK(setWeightsSum == indexWeightsSum);
+		Benchmark::report("std::set<Edge>::find, 4M queries on 1M edges", setTime);
+		Benchmark::reportSpeedup("EdgeIndex::find, 4M queries on 1M edges", setTime, indexTime);
+	}
+}
@@ -3,6 +3,8 @@
 #include "GraphEditor.hpp"
 #include <vector>
 #include <string>
+#include <future>
+#include <cstdint>
 
 class AlgorithmsPanel
 {
@@ -18,10 +20,29 @@ private:
 	void showDfsOptions();
 	void showBfsOptions();
 	void showDijkstraOptions();
+	void showAStarOptions();
 	void showColoringOptions();
 	void showFindIslandsOptions();
 	void showKruskalMSTOptions();
 	void showNodesDegreesOptions();
+	void showEccentricitiesOptions();
+
+	struct AlgorithmResult
+	{
+		GraphAlgorithms::TraversalOrder traversalOrder;
+		std::optional<GraphAlgorithms::NodesColorsIdxs> nodesColorsIdxs;
+		// Shown below the algorithm options
+		std::string message;
+		// Version of the graph snapshot the algorithm was run on
+		std::uint64_t graphVersion{ 0 };
+	};
+
+	// Runs the algorithm in the background on a snapshot of the graph, so the graph can be edited in the meantime
+	template<typename Function>
+	void execute(Function&& algorithm);
+	bool isAlgorithmRunning() const { return pendingResult.valid(); }
+	// Starts the animation of the finished algorithm, if its result is still up to date
+	void collectResult();
 
 private:
 	Graph& graph;
@@ -33,18 +54,28 @@ private:
 		DFS,
 		BFS,
 		Dijkstra,
+		AStar,
 		Coloring,
 		FindIslands,
 		KruskalMST,
 		NodesDegrees,
+		Eccentricities,
 	} selectedAlgorithm{ SelectedAlgorithm::None };
 	int selectedAlgorithmIdx{ 0 };
 
 	bool loopAnimation{ false };
+	// Index of GraphAlgorithms::ColoringStrategy
+	int coloringStrategyIdx{ 0 };
 
 	std::optional<GraphAlgorithms::TraversalOrder> traversalOrder;
 	std::optional<GraphAlgorithms::NodesColorsIdxs> nodesColorsIdxs;
 
 	int startNode{ 0 };
 	int endNode{ 0 };
+
+	std::future<AlgorithmResult> pendingResult;
+	// Set when the selected algorithm changes while an algorithm is running
+	bool discardPendingResult{ false };
+	bool showOutdatedResultMessage{ false };
+	std::string resultMessage;
 };
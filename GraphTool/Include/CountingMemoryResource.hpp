@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory_resource>
+#include <cstddef>
+#include <algorithm>
+
+// Memory resource forwarding all allocations to the upstream resource and keeping track of the allocated bytes
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+public:
+	explicit CountingMemoryResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+		: upstream{ upstream } {}
+
+	std::size_t getAllocatedBytes() const { return allocatedBytes; }
+	std::size_t getPeakAllocatedBytes() const { return peakAllocatedBytes; }
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		void* result{ upstream->allocate(bytes, alignment) };
+		allocatedBytes += bytes;
+		peakAllocatedBytes = std::max(peakAllocatedBytes, allocatedBytes);
+		return result;
+	}
+
+	void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+	{
+		upstream->deallocate(pointer, bytes, alignment);
+		allocatedBytes -= bytes;
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+
+private:
+	std::pmr::memory_resource* upstream;
+	std::size_t allocatedBytes{ 0 };
+	std::size_t peakAllocatedBytes{ 0 };
+};
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+// Open addressing hash map keyed on edges, with the (a, b) node ids packed into a single 64-bit key.
+// Collisions are resolved with linear probing and erased entries are removed with backward shifting,
+// so lookups never have to skip tombstones.
+template<typename Value>
+class EdgeIndex
+{
+public:
+	explicit EdgeIndex(std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource())
+		: entries{ memoryResource } {}
+
+	static std::uint64_t makeKey(int a, int b)
+	{
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(a)) << 32) | static_cast<std::uint32_t>(b);
+	}
+
+	void reserve(std::size_t newCount)
+	{
+		std::size_t newCapacity{ minCapacity };
+		while (newCount * maxLoadDenominator > newCapacity * maxLoadNumerator) {
+			newCapacity *= 2;
+		}
+		if (newCapacity > entries.size()) {
+			rehash(newCapacity);
+		}
+	}
+
+	// Returns false if the edge already exists, its value is not changed then
+	bool insert(int a, int b, Value value)
+	{
+		if ((count + 1) * maxLoadDenominator > entries.size() * maxLoadNumerator) {
+			rehash(entries.empty() ? minCapacity : entries.size() * 2);
+		}
+
+		const std::uint64_t key{ makeKey(a, b) };
+		std::size_t i{ getHomeSlot(key) };
+		while (entries[i].key != emptyKey) {
+			if (entries[i].key == key) {
+				return false;
+			}
+			i = (i + 1) & mask;
+		}
+
+		entries[i] = Entry{ key, std::move(value) };
+		++count;
+		return true;
+	}
+
+	bool erase(int a, int b)
+	{
+		const std::optional<std::size_t> slot{ findSlot(makeKey(a, b)) };
+		if (!slot.has_value()) {
+			return false;
+		}
+
+		// Shift back the following entries of the cluster which would become unreachable
+		std::size_t i{ *slot };
+		std::size_t j{ i };
+		while (true) {
+			j = (j + 1) & mask;
+			if (entries[j].key == emptyKey) {
+				break;
+			}
+
+			const std::size_t home{ getHomeSlot(entries[j].key) };
+			const bool isHomeBetween{ (i <= j) ? (i < home && home <= j) : (i < home || home <= j) };
+			if (!isHomeBetween) {
+				entries[i] = std::move(entries[j]);
+				i = j;
+			}
+		}
+
+		entries[i] = Entry{};
+		--count;
+		return true;
+	}
+
+	// Releases the memory of the entries as well
+	void clear()
+	{
+		std::pmr::vector<Entry>{ entries.get_allocator() }.swap(entries);
+		mask = 0;
+		count = 0;
+	}
+
+	bool contains(int a, int b) const { return findSlot(makeKey(a, b)).has_value(); }
+
+	// Returns nullptr if the edge doesn't exist
+	const Value* find(int a, int b) const
+	{
+		const std::optional<std::size_t> slot{ findSlot(makeKey(a, b)) };
+		return slot.has_value() ? &entries[*slot].value : nullptr;
+	}
+
+	Value* find(int a, int b)
+	{
+		const std::optional<std::size_t> slot{ findSlot(makeKey(a, b)) };
+		return slot.has_value() ? &entries[*slot].value : nullptr;
+	}
+
+	std::size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+
+private:
+	static constexpr std::uint64_t emptyKey{ ~std::uint64_t{ 0 } };
+	static constexpr std::size_t minCapacity{ 16 };
+	// Maximum load factor of 0.7
+	static constexpr std::size_t maxLoadNumerator{ 7 };
+	static constexpr std::size_t maxLoadDenominator{ 10 };
+
+	struct Entry
+	{
+		std::uint64_t key{ emptyKey };
+		Value value{};
+	};
+
+	std::size_t getHomeSlot(std::uint64_t key) const
+	{
+		// splitmix64 finalizer, so consecutive node ids don't end up in the same cluster
+		key ^= key >> 30;
+		key *= 0xbf58476d1ce4e5b9ull;
+		key ^= key >> 27;
+		key *= 0x94d049bb133111ebull;
+		key ^= key >> 31;
+		return static_cast<std::size_t>(key) & mask;
+	}
+
+	std::optional<std::size_t> findSlot(std::uint64_t key) const
+	{
+		if (count == 0) {
+			return std::nullopt;
+		}
+
+		std::size_t i{ getHomeSlot(key) };
+		while (entries[i].key != emptyKey) {
+			if (entries[i].key == key) {
+				return i;
+			}
+			i = (i + 1) & mask;
+		}
+		return std::nullopt;
+	}
+
+	void rehash(std::size_t newCapacity)
+	{
+		std::pmr::vector<Entry> oldEntries(newCapacity, entries.get_allocator());
+		oldEntries.swap(entries);
+		mask = newCapacity - 1;
+
+		for (Entry& entry : oldEntries) {
+			if (entry.key != emptyKey) {
+				std::size_t i{ getHomeSlot(entry.key) };
+				while (entries[i].key != emptyKey) {
+					i = (i + 1) & mask;
+				}
+				entries[i] = std::move(entry);
+			}
+		}
+	}
+
+	std::pmr::vector<Entry> entries;
+	std::size_t mask{ 0 };
+	std::size_t count{ 0 };
+};
@@ -2,9 +2,19 @@
 
 #include <map>
 #include <set>
+#include <vector>
+#include <string>
 #include <utility>
 #include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include "Event.hpp"
+#include "NodeIndex.hpp"
+#include "EdgeIndex.hpp"
+#include "CountingMemoryResource.hpp"
+#include "GraphJournal.hpp"
+#include "UnionFind.hpp"
 
 class Node
 {
@@ -42,6 +52,8 @@ inline bool operator>=(const Edge& lhs, const Edge& rhs) { return !(rhs < lhs);
 inline bool operator==(const Edge& lhs, const Edge& rhs) { return (lhs.a == rhs.a && lhs.b == rhs.b); }
 inline bool operator!=(const Edge& lhs, const Edge& rhs) { return !(lhs == rhs); }
 
+class GraphSnapshot;
+
 enum class Directed
 {
 	Yes,
@@ -57,9 +69,23 @@ enum class Weighted
 class Graph
 {
 public:
-	Graph();
+	// Containers of the graph allocate from a pool owned by the graph, which gets its memory from the upstream resource
+	explicit Graph(std::pmr::memory_resource* upstreamMemoryResource = std::pmr::get_default_resource());
+	// Containers of the graph use the graph's own memory pool, so it can't be trivially copied
+	Graph(const Graph&) = delete;
+	Graph& operator=(const Graph&) = delete;
+
+	using AdjacencyList = std::pmr::map<int, std::pmr::set<int>>;
 
-	using AdjacencyList = std::map<int, std::set<int>>;
+	struct MemoryUsage
+	{
+		// Bytes currently allocated by the containers from the pool
+		std::size_t usedBytes{ 0 };
+		// Bytes the pool currently holds from the upstream resource
+		std::size_t reservedBytes{ 0 };
+		// Bytes allocated outside of the pool, by the node index, the components, the journal and the cached snapshot
+		std::size_t unpooledBytes{ 0 };
+	};
 
 	Event<std::vector<std::pair<int, int>>> onDirectedEdgesDeleted;
 	Event<std::vector<std::pair<int, int>>> onUndirectedEdgesDeleted;
@@ -67,6 +93,9 @@ public:
 	Event<> onLoadedFromFile;
 
 	void addEdge(int a, int b);
+	// Adds all the edges in one pass, after sorting and deduplicating them. Edges connecting not existing nodes and already existing edges are skipped.
+	// Weights of the given edges become the directed edges weights, new undirected edges have weight 0 like in addEdge()
+	void addEdges(std::vector<Edge> edges);
 
 	void setEdgeWeight(int a, int b, int newWeight);
 	void setEdgeWeight(int a, int b, int newWeight, Directed directed);
@@ -74,11 +103,14 @@ public:
 
 	// Creates a new node and returns id of the node
 	int createNode();
+	// Creates count nodes with consecutive ids and returns id of the first one
+	int createNodes(int count);
 	void setNextNodeId(int newNextNodeId);
 
 	void deleteNode(int nodeId);
 	void deleteEdge(int a, int b);
 
+	// Clears the graph and returns all the pooled memory to the upstream resource at once
 	void reset();
 
 	void makeDirected();
@@ -91,28 +123,135 @@ public:
 	bool doesNodeExist(int nodeId) const;
 	bool doesEdgeExist(int a, int b) const;
 
-	const AdjacencyList& getAdjacencyList() const { return isDirected() ? directedAdjList : undirectedAdjList; }
-	const std::set<Node>& getNodes() const { return nodes; }
-	const std::set<Edge>& getEdges() const { return isDirected() ? directedEdges : undirectedEdges; }
-	const std::set<Edge>& getDirectedEdges() const { return directedEdges; }
-	const std::set<Edge>& getUndirectedEdges() const { return undirectedEdges; }
+	// Dense index of the nodes, lets algorithms keep per-node state in flat arrays
+	const NodeIndex& getNodes() const { return nodes; }
+	// Edges are stored once, as directed edges. The builders copy them into a new container on every call, O(nodes + edges),
+	// in the current directed mode, with a row for every node and edges sorted by (a, b).
+	// Repeated reads should use forEachNeighbor(), getOutNeighbors() / getInNeighbors() or snapshot() instead.
+	AdjacencyList buildAdjacencyList() const;
+	std::vector<Edge> buildEdges() const { return isDirected() ? buildDirectedEdges() : buildUndirectedEdges(); }
+	std::vector<Edge> buildDirectedEdges() const;
+	// Undirected edges have .a being the smaller node id and .b being the bigger node id
+	std::vector<Edge> buildUndirectedEdges() const;
 	std::vector<std::string> getNodesIdsStrings() const;
 
+	// Directed edges going out of / into the node, in ascending id order, regardless of the current directed mode
+	const std::pmr::set<int>& getOutNeighbors(int nodeId) const;
+	const std::pmr::set<int>& getInNeighbors(int nodeId) const;
+
+	// Nodes are in the same component if they are connected by a path, with the edges treated as undirected.
+	// Components are merged as edges are added. Deleting an edge searches from both of its ends until they meet,
+	// if they don't, only the smaller of the two parts is relabeled.
+	bool sameComponent(int a, int b) const;
+	// Identifies the component of the node, the same for all the nodes of the component until the graph is changed.
+	// Returns -1 if the node doesn't exist.
+	int getComponentId(int nodeId) const;
+
+	// Calls function(neighborId, weight) for every neighbor of the node in the current directed mode, in ascending id order.
+	// Weight is the stored weight of the edge, also when the graph is not weighted.
+	template<typename Function>
+	void forEachNeighbor(int nodeId, Function&& function) const;
+
+	MemoryUsage getMemoryUsage() const;
+
+	// Incremented with every change of the graph, including changes of the directed/weighted mode
+	std::uint64_t version() const { return journal.getVersion(); }
+	// Journal is disabled by default, with a non-zero capacity the latest changes can be read with getChangesSince()
+	void setJournalCapacity(std::size_t capacity) { journal.setCapacity(capacity); }
+	std::optional<std::vector<GraphChange>> getChangesSince(std::uint64_t sinceVersion) const { return journal.getChangesSince(sinceVersion); }
+
+	// Immutable CSR view of the graph in its current directed/weighted mode. It is built once per version of the graph
+	// and shared, so it can be used from other threads while the graph keeps being edited. Building it copies the whole
+	// graph, O(nodes + edges), so after every edit the first call pays for a full rebuild on the calling thread.
+	// Calling it concurrently is safe as long as the graph isn't being edited at the same time.
+	std::shared_ptr<const GraphSnapshot> snapshot() const;
+
 	bool doesDirectedEdgeExist(int a, int b) const;
 	bool doesUndirectedEdgeExist(int a, int b) const;
 
 private:
+	// Erase the edge from both the adjacency lists and the weights, return false if the edge doesn't exist
+	bool eraseDirectedEdge(int a, int b);
+	int getUndirectedEdgeWeight(int a, int b) const;
+	// Called after the last edge between the nodes was deleted, gives the part of the component which got disconnected
+	// from the other node a new label. Returns false if the nodes are still connected.
+	bool splitComponent(int a, int b);
+	// Returns a label for a new component, the labels are renumbered first if most of them are no longer used
+	int createComponentLabel();
+	// Same as forEachNeighbor() in undirected mode, regardless of the current mode
+	template<typename Function>
+	void forEachUndirectedNeighbor(int nodeId, Function&& function) const;
+
 	Directed directed{ Directed::No };
 	Weighted weighted{ Weighted::No };
 
-	AdjacencyList directedAdjList;
-	AdjacencyList undirectedAdjList;
+	// Not allocated from the memory pool, as it has to outlive reset()
+	GraphJournal journal;
+	// Cache of snapshot(), the only state changed by const member functions
+	mutable std::shared_ptr<const GraphSnapshot> lastSnapshot;
+	mutable std::mutex lastSnapshotMutex;
 
-	std::set<Node> nodes;
+	// Memory resources have to be declared before the containers using them, so they outlive the containers
+	CountingMemoryResource reservedMemory;
+	std::pmr::unsynchronized_pool_resource memoryPool;
+	CountingMemoryResource usedMemory;
+
+	NodeIndex nodes;
 	int nextNodeId{ 1 };
 
-	// Directed & undirected edges are stored separately so user can easily switch between directed & undirected graph
-	std::set<Edge> directedEdges;
-	// Undirected edges are stored with .a being the smaller node id and .b being the bigger node id
-	std::set<Edge> undirectedEdges;
+	// Only directed edges are stored, undirected edge connects two nodes if there is a directed edge between them in any direction,
+	// so switching between directed & undirected graph doesn't have to touch the edges.
+	// Outgoing edges of the nodes
+	AdjacencyList directedAdjList;
+	// Incoming edges of the nodes, so all the edges connected to a node can be found without scanning the whole graph
+	AdjacencyList reversedAdjList;
+
+	// Weights of the directed edges, also used for O(1) existence checks
+	EdgeIndex<int> directedEdgesWeights;
+	// Undirected edges weights are set independently of the directed ones. They are keyed on (smaller id, bigger id)
+	// and only non-zero weights are stored, as every new undirected edge has weight 0.
+	EdgeIndex<int> undirectedEdgesWeights;
+
+	// Component label of every node, indexed by the dense index of the node in nodes. Labels of nodes connected by an edge
+	// are united in components, labels of the nodes disconnected by a deletion are replaced by a new one.
+	std::vector<int> nodesLabels;
+	UnionFind components;
 };
+
+template<typename Function>
+void Graph::forEachNeighbor(int nodeId, Function&& function) const
+{
+	if (!isDirected()) {
+		forEachUndirectedNeighbor(nodeId, function);
+		return;
+	}
+
+	for (const int neighborId : getOutNeighbors(nodeId)) {
+		function(neighborId, *directedEdgesWeights.find(nodeId, neighborId));
+	}
+}
+
+template<typename Function>
+void Graph::forEachUndirectedNeighbor(int nodeId, Function&& function) const
+{
+	// Merge outgoing and incoming edges, both rows are sorted
+	const std::pmr::set<int>& outgoing{ getOutNeighbors(nodeId) };
+	const std::pmr::set<int>& incoming{ getInNeighbors(nodeId) };
+
+	auto outgoingNeighbor{ outgoing.begin() };
+	auto incomingNeighbor{ incoming.begin() };
+	while (outgoingNeighbor != outgoing.end() || incomingNeighbor != incoming.end()) {
+		int neighborId{ 0 };
+		if (incomingNeighbor == incoming.end() || (outgoingNeighbor != outgoing.end() && *outgoingNeighbor < *incomingNeighbor)) {
+			neighborId = *outgoingNeighbor++;
+		}
+		else if (outgoingNeighbor == outgoing.end() || *incomingNeighbor < *outgoingNeighbor) {
+			neighborId = *incomingNeighbor++;
+		}
+		else {
+			neighborId = *outgoingNeighbor++;
+			++incomingNeighbor;
+		}
+		function(neighborId, getUndirectedEdgeWeight(nodeId, neighborId));
+	}
+}
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "Graph.hpp"
+#include "GraphSnapshot.hpp"
+#include "Parallel.hpp"
 #include <vector>
 #include <optional>
+#include <functional>
+#include <limits>
 
 namespace GraphAlgorithms
 {
@@ -18,11 +22,159 @@ namespace GraphAlgorithms
 
 	using NodesColorsIdxs = std::map<int, std::optional<int>>;
 
+	// Priority queue used by Dijkstra's algorithm in weighted graph.
+	// Bucket queue is chosen automatically if all the weights are in range [0, bucketQueueMaxWeight]. It needs non-negative weights
+	// and allocates a bucket for every weight, so the binary heap is used otherwise even if the bucket queue is requested.
+	enum class ShortestPathQueue
+	{
+		Automatic,
+		BinaryHeap,
+		BucketQueue
+	};
+
+	inline constexpr int bucketQueueMaxWeight{ 255 };
+
+	// The distance matrix takes 4 or 8 bytes for every pair of nodes, eccentricities of larger graphs aren't computed by the UI
+	inline constexpr int eccentricitiesMaxNodesCount{ 10000 };
+
+	// Order in which the nodes are colored, every node gets the smallest color not used by its neighbors.
+	// Edges of directed graphs are treated as undirected.
+	enum class ColoringStrategy
+	{
+		// Ascending node ids
+		Greedy,
+		// Reverse of removing the nodes with the smallest degree one by one, uses at most degeneracy + 1 colors
+		SmallestLast,
+		// Node with the most distinct colors among its neighbors first
+		DSatur,
+		// Random priorities, nodes without uncolored neighbors with higher priorities are colored in parallel rounds
+		JonesPlassmann
+	};
+
+	struct SearchStatistics
+	{
+		// Nodes whose edges were relaxed, the end node is not counted
+		int expandedNodesCount{ 0 };
+	};
+
+	// Shortest paths from a single node to all the nodes, indexed by node indices of the snapshot the algorithm was run on
+	struct ShortestPaths
+	{
+		// std::numeric_limits<int>::max() for nodes which can't be reached
+		std::vector<int> distances;
+		// Index of the previous node on the shortest path, -1 for the start node and nodes which can't be reached
+		std::vector<int> predecessors;
+	};
+
+	// Distances between all pairs of nodes. They are 32-bit if no path of the graph can reach intUnreachable, which halves the memory,
+	// and 64-bit otherwise, so that paths of any int weights fit. Only one of the two arrays is filled.
+	struct DistanceMatrix
+	{
+		// Distance between nodes without a path, large enough that no path is that long, small enough that adding two doesn't overflow
+		static constexpr long long unreachable{ std::numeric_limits<long long>::max() / 4 };
+		// Same for the 32-bit distances, getDistance() returns it as unreachable
+		static constexpr int intUnreachable{ std::numeric_limits<int>::max() / 2 };
+		// Floyd-Warshall processes the matrix in square tiles of this size
+		static constexpr int tileSize{ 64 };
+
+		int nodesCount{ 0 };
+		// Row-major, rows and columns are indexed by node indices of the snapshot the algorithm was run on
+		std::vector<int> intDistances;
+		std::vector<long long> longDistances;
+		// Distances of the nodes reachable through a negative cycle are meaningless then
+		bool hasNegativeCycle{ false };
+
+		bool hasIntDistances() const { return !intDistances.empty(); }
+		long long getDistance(int from, int to) const
+		{
+			const std::size_t idx{ static_cast<std::size_t>(from) * nodesCount + to };
+			if (hasIntDistances()) {
+				return intDistances[idx] == intUnreachable ? unreachable : intDistances[idx];
+			}
+			return longDistances[idx];
+		}
+	};
+
+	// Connected components, edges of directed graphs are treated as undirected
+	struct ConnectedComponents
+	{
+		// Component of every node, indexed by node indices of the snapshot the algorithm was run on.
+		// Components are numbered in the order of their smallest node indices.
+		std::vector<int> componentsIdxs;
+		int componentsCount{ 0 };
+	};
+
+	// Compact form of the distance matrix
+	struct DistancesSummary
+	{
+		// Largest distance from the node to the nodes reachable from it, indexed by node indices
+		std::vector<long long> eccentricities;
+		long long diameter{ 0 };
+		long long radius{ 0 };
+		bool hasNegativeCycle{ false };
+	};
+
+	// Returns (x, y) position of the node with the given id
+	using PositionLookup = std::function<std::pair<float, float>(int nodeId)>;
+
+	// Graph overloads build a snapshot of the graph and run the algorithm on it
 	TraversalOrder dfs(const Graph& graph, int startNode);
-	TraversalOrder bfs(const Graph& graph, int startNode);
-	TraversalOrder dijkstra(const Graph& graph, int startNode, int endNode);
-	std::pair<TraversalOrder, NodesColorsIdxs> coloring(const Graph& graph);
+	// Parallel BFS visits the same nodes level by level, but nodes of each level come in ascending id order
+	// and every node has the smallest id node of the previous level connected to it as its parent
+	TraversalOrder bfs(const Graph& graph, int startNode, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential);
+	TraversalOrder dijkstra(const Graph& graph, int startNode, int endNode, ShortestPathQueue queue = ShortestPathQueue::Automatic,
+		SearchStatistics* statistics = nullptr);
+	// Dijkstra's algorithm guided by the straight line distance to the end node, scaled down so the path is still the shortest one.
+	// Prunes most of the search if the weights grow with the distance between the nodes. Ties can be resolved differently than in dijkstra.
+	TraversalOrder aStar(const Graph& graph, int startNode, int endNode, const PositionLookup& getPosition, SearchStatistics* statistics = nullptr);
+	// Searches from both ends at once and returns the path in the same form as dijkstra, it settles far fewer nodes
+	// on large sparse graphs. If there are several shortest paths, it can return a different one than dijkstra.
+	TraversalOrder bidirectionalDijkstra(const Graph& graph, int startNode, int endNode);
+	// Sequential version runs Dijkstra's algorithm over the whole graph, parallel version uses delta-stepping with buckets of delta width
+	// (chosen from the weights and degrees if delta is not positive, raised if the buckets would outnumber the nodes).
+	// Distances are the same, but if there are several shortest paths the parallel version picks the smallest index predecessor
+	// among the ones settled before the node, so zero weight edges can't make a cycle. Graphs with negative weights always use the sequential version.
+	// Graph overload returns indices of graph.snapshot().
+	ShortestPaths shortestPaths(const Graph& graph, int startNode, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential, int delta = 0);
+	// Blocked Floyd-Warshall on a dense matrix, meant for graphs up to around 10k nodes (see eccentricitiesMaxNodesCount).
+	// A negative cycle is reported if some node has a negative distance to itself.
+	DistanceMatrix allPairsShortestPaths(const Graph& graph, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential);
+	DistancesSummary summarizeDistances(const DistanceMatrix& distanceMatrix);
+	// Colors the nodes by their eccentricity, the summary of the distances is written to summary if it's not null
+	std::pair<TraversalOrder, NodesColorsIdxs> eccentricities(const Graph& graph, DistancesSummary* summary = nullptr);
+	// Isolated nodes are colored as well
+	std::pair<TraversalOrder, NodesColorsIdxs> coloring(const Graph& graph, ColoringStrategy strategy = ColoringStrategy::Greedy);
+	// Checks that every node has a color and no two adjacent nodes share one, loops are ignored
+	bool isColoringValid(const Graph& graph, const NodesColorsIdxs& nodesColorsIdxs);
+	// Afforest union-find connected components, no traversal is needed. Graph overload returns indices of graph.snapshot().
+	ConnectedComponents connectedComponents(const Graph& graph, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential);
+	// Colors the nodes by connected component, islands of directed graphs are weakly connected.
+	// Use Graph::sameComponent() to check just a few nodes without building a snapshot.
 	std::pair<TraversalOrder, NodesColorsIdxs> findIslands(const Graph& graph);
+	// Edges are sorted with counting sort if the range of the weights is small, like the weights set in the editor
 	TraversalOrder kruskalMST(const Graph& graph);
+	// Same edges as kruskalMST, ordered by the time they join the tree instead of by weight. Faster than kruskalMST only
+	// on dense graphs (16+ edges per node) with a range of weights too wide for counting sort.
+	TraversalOrder primMST(const Graph& graph);
+	// Parallel minimum spanning forest, the result is the same as from kruskalMST
+	TraversalOrder boruvkaMST(const Graph& graph);
 	std::pair<TraversalOrder, NodesColorsIdxs> nodesDegrees(const Graph& graph);
+
+	TraversalOrder dfs(const GraphSnapshot& graph, int startNode);
+	TraversalOrder bfs(const GraphSnapshot& graph, int startNode, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential);
+	TraversalOrder dijkstra(const GraphSnapshot& graph, int startNode, int endNode, ShortestPathQueue queue = ShortestPathQueue::Automatic,
+		SearchStatistics* statistics = nullptr);
+	TraversalOrder aStar(const GraphSnapshot& graph, int startNode, int endNode, const PositionLookup& getPosition, SearchStatistics* statistics = nullptr);
+	TraversalOrder bidirectionalDijkstra(const GraphSnapshot& graph, int startNode, int endNode);
+	ShortestPaths shortestPaths(const GraphSnapshot& graph, int startNode, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential, int delta = 0);
+	DistanceMatrix allPairsShortestPaths(const GraphSnapshot& graph, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential);
+	std::pair<TraversalOrder, NodesColorsIdxs> eccentricities(const GraphSnapshot& graph, DistancesSummary* summary = nullptr);
+	std::pair<TraversalOrder, NodesColorsIdxs> coloring(const GraphSnapshot& graph, ColoringStrategy strategy = ColoringStrategy::Greedy);
+	bool isColoringValid(const GraphSnapshot& graph, const NodesColorsIdxs& nodesColorsIdxs);
+	ConnectedComponents connectedComponents(const GraphSnapshot& graph, ExecutionPolicy executionPolicy = ExecutionPolicy::Sequential);
+	std::pair<TraversalOrder, NodesColorsIdxs> findIslands(const GraphSnapshot& graph);
+	TraversalOrder kruskalMST(const GraphSnapshot& graph);
+	TraversalOrder primMST(const GraphSnapshot& graph);
+	TraversalOrder boruvkaMST(const GraphSnapshot& graph);
+	std::pair<TraversalOrder, NodesColorsIdxs> nodesDegrees(const GraphSnapshot& graph);
 }
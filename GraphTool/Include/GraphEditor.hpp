@@ -34,6 +34,8 @@ public:
 	void createNewNode(const sf::Vector2f& mousePosition);
 	// Returns pointers to the created directed edge shape and undirected edge shape
 	std::pair<GraphEdgeShape*, GraphEdgeShape*> createNewEdge(int a, int b);
+	// Creates shapes for all edges of the graph, used after the edges were added to the graph in bulk
+	void createEdgesShapes();
 
 	const std::vector<GraphNodeShape>& getNodesShapes() const { return nodesShapes; }
 
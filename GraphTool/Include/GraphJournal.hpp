@@ -0,0 +1,60 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+struct GraphChange
+{
+	enum class Type
+	{
+		NodeCreated,
+		NodeDeleted,
+		// Edges are journaled as directed edges only, undirected edges follow from them
+		DirectedEdgeAdded,
+		DirectedEdgeDeleted,
+		DirectedWeightChanged,
+		UndirectedWeightChanged,
+		DirectedModeChanged,
+		WeightedModeChanged,
+		Cleared
+	};
+
+	Type type{ Type::Cleared };
+	// Version of the graph right after the change
+	std::uint64_t version{ 0 };
+	// Node id for node changes, edge nodes for edge changes (undirected weights use the smaller id as a),
+	// new mode value (1/0) in a for mode changes
+	int a{ 0 };
+	int b{ 0 };
+	// New weight for weight changes and weight of the added edges
+	int weight{ 0 };
+};
+
+// Version counter of the graph together with a bounded log of the latest changes,
+// so the users of the graph can apply only the changes made since their last update instead of rescanning the graph
+class GraphJournal
+{
+public:
+	// Capacity of 0 disables journaling, the version is still incremented with every change then
+	void setCapacity(std::size_t newCapacity);
+	std::size_t getCapacity() const { return capacity; }
+
+	// Increments the version and appends the change, dropping the oldest one if the journal is full
+	void record(GraphChange::Type type, int a = 0, int b = 0, int weight = 0);
+
+	std::uint64_t getVersion() const { return version; }
+	// Changes made after the given version, from the oldest one.
+	// Returns nullopt if some of these changes were already dropped from the journal, the graph has to be rescanned then.
+	std::optional<std::vector<GraphChange>> getChangesSince(std::uint64_t sinceVersion) const;
+
+	// Memory taken by the stored changes, without the partially filled blocks of the deque
+	std::size_t getAllocatedBytes() const { return changes.size() * sizeof(GraphChange); }
+
+private:
+	std::deque<GraphChange> changes;
+	std::size_t capacity{ 0 };
+	std::uint64_t version{ 0 };
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class Graph;
+
+// Immutable compressed sparse row (CSR) view of the graph used by the algorithms.
+// Nodes are remapped to dense indices in ascending id order and neighbors of each node are sorted by id,
+// so traversing the snapshot visits nodes in the same order as traversing the graph's adjacency list.
+// There is no incremental update, a new version of the graph is copied into a new snapshot in O(nodes + edges).
+class GraphSnapshot
+{
+public:
+	explicit GraphSnapshot(const Graph& graph);
+
+	// Version of the graph the snapshot was built from
+	std::uint64_t getVersion() const { return version; }
+	bool isDirected() const { return directed; }
+	bool isWeighted() const { return weighted; }
+
+	int getNodesCount() const { return static_cast<int>(nodesIds.size()); }
+	// Undirected edges are counted once
+	int getEdgesCount() const { return edgesCount; }
+
+	int getNodeId(int nodeIdx) const { return nodesIds[nodeIdx]; }
+	// Returns -1 if there is no node with the given id
+	int getNodeIdx(int nodeId) const;
+
+	// Neighbors of a node are stored in range [offsets[nodeIdx], offsets[nodeIdx + 1]) of the neighbors and weights arrays
+	const std::vector<int>& getOffsets() const { return offsets; }
+	const std::vector<int>& getNeighbors() const { return neighbors; }
+	// Weights are aligned with the neighbors array and have the same values as Graph::getEdgeWeight()
+	const std::vector<int>& getWeights() const { return weights; }
+	int getDegree(int nodeIdx) const { return offsets[nodeIdx + 1] - offsets[nodeIdx]; }
+	// Both are 0 if there are no edges
+	int getMinWeight() const { return minWeight; }
+	int getMaxWeight() const { return maxWeight; }
+
+	// Incoming edges of the nodes stored the same way as the outgoing ones, rows are sorted by id as well.
+	// In undirected graph these are the same arrays as the outgoing ones.
+	const std::vector<int>& getInOffsets() const { return directed ? inOffsets : offsets; }
+	const std::vector<int>& getInNeighbors() const { return directed ? inNeighbors : neighbors; }
+	const std::vector<int>& getInWeights() const { return directed ? inWeights : weights; }
+	int getInDegree(int nodeIdx) const { return getInOffsets()[nodeIdx + 1] - getInOffsets()[nodeIdx]; }
+
+	std::size_t getAllocatedBytes() const;
+
+private:
+	std::uint64_t version{ 0 };
+	bool directed{ false };
+	bool weighted{ false };
+	int edgesCount{ 0 };
+	int minWeight{ 0 };
+	int maxWeight{ 0 };
+
+	std::vector<int> nodesIds;
+	// Indexed by (node id - firstNodeId), -1 for ids without a node. Left empty if the ids are sparse,
+	// so the table doesn't outgrow the graph, the index is found by binary search in nodesIds then.
+	std::vector<int> nodesIdxs;
+	int firstNodeId{ 0 };
+
+	std::vector<int> offsets;
+	std::vector<int> neighbors;
+	std::vector<int> weights;
+
+	// Only filled in directed graph
+	std::vector<int> inOffsets;
+	std::vector<int> inNeighbors;
+	std::vector<int> inWeights;
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+
+// d-ary min-heap of elements [0, size) with a position for every element, so their keys can be decreased in place.
+// Higher arity makes the heap shallower, which pays off when keys are decreased more often than the minimum is popped.
+template<typename Key, int arity = 4>
+class IndexedHeap
+{
+	static_assert(arity >= 2, "Heap arity must be at least 2");
+
+public:
+	explicit IndexedHeap(int size = 0) { reset(size); }
+
+	// Removes all elements from the heap
+	void reset(int size)
+	{
+		positions.assign(size, notInHeap);
+		entries.clear();
+	}
+
+	bool empty() const { return entries.empty(); }
+	int size() const { return static_cast<int>(entries.size()); }
+	bool contains(int element) const { return positions[element] != notInHeap; }
+
+	// The element has to be in the heap
+	const Key& getKey(int element) const { return entries[positions[element]].key; }
+
+	int top() const { return entries.front().element; }
+	const Key& topKey() const { return entries.front().key; }
+
+	// Inserts the element or decreases its key, returns false if the key of the element is not smaller than the current one
+	bool pushOrDecreaseKey(int element, const Key& key)
+	{
+		int position{ positions[element] };
+		if (position == notInHeap) {
+			position = size();
+			entries.push_back(Entry{ key, element });
+		}
+		else if (key < entries[position].key) {
+			entries[position].key = key;
+		}
+		else {
+			return false;
+		}
+
+		siftUp(position);
+		return true;
+	}
+
+	int pop()
+	{
+		const int element{ entries.front().element };
+		positions[element] = notInHeap;
+
+		if (entries.size() > 1) {
+			entries.front() = std::move(entries.back());
+			entries.pop_back();
+			siftDown(0);
+		}
+		else {
+			entries.pop_back();
+		}
+		return element;
+	}
+
+private:
+	static constexpr int notInHeap{ -1 };
+
+	struct Entry
+	{
+		Key key;
+		int element{ 0 };
+	};
+
+	// Moved entry is kept aside and written once its position is found
+	void siftUp(int position)
+	{
+		Entry entry{ std::move(entries[position]) };
+		while (position > 0) {
+			const int parent{ (position - 1) / arity };
+			if (!(entry.key < entries[parent].key)) {
+				break;
+			}
+			place(std::move(entries[parent]), position);
+			position = parent;
+		}
+		place(std::move(entry), position);
+	}
+
+	void siftDown(int position)
+	{
+		const int entriesCount{ size() };
+		Entry entry{ std::move(entries[position]) };
+		while (true) {
+			const int firstChild{ position * arity + 1 };
+			if (firstChild >= entriesCount) {
+				break;
+			}
+
+			int minChild{ firstChild };
+			const int lastChild{ firstChild + arity < entriesCount ? firstChild + arity : entriesCount };
+			for (int child{ firstChild + 1 }; child < lastChild; ++child) {
+				if (entries[child].key < entries[minChild].key) {
+					minChild = child;
+				}
+			}
+
+			if (!(entries[minChild].key < entry.key)) {
+				break;
+			}
+			place(std::move(entries[minChild]), position);
+			position = minChild;
+		}
+		place(std::move(entry), position);
+	}
+
+	void place(Entry&& entry, int position)
+	{
+		positions[entry.element] = position;
+		entries[position] = std::move(entry);
+	}
+
+	std::vector<int> positions;
+	std::vector<Entry> entries;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Generational slot map from user visible node ids to contiguous dense indices.
+// Slots are addressed directly by the node id (ids have to be non-negative), so they take memory up to the largest id ever inserted,
+// but the nodes are iterated over the dense and sorted id arrays, which only hold the existing nodes. The dense array is kept contiguous
+// by moving the last node into the place of the erased one, so dense indices of the nodes can change after erase.
+class NodeIndex
+{
+public:
+	// Identifies a node together with the generation of its slot,
+	// so a handle to an erased node is not valid even if a new node with the same id is created
+	struct Handle
+	{
+		int nodeId{ 0 };
+		std::uint32_t generation{ 0 };
+	};
+
+	// Returns dense index of the node, does nothing if the node already exists
+	int insert(int nodeId);
+	void erase(int nodeId);
+	void reserve(int count, int maxNodeId);
+	void clear();
+
+	bool contains(int nodeId) const { return getIdx(nodeId) != -1; }
+	// Returns -1 if there is no node with the given id
+	int getIdx(int nodeId) const;
+	int getId(int idx) const { return ids[idx]; }
+
+	Handle getHandle(int nodeId) const;
+	bool isValid(const Handle& handle) const;
+
+	int size() const { return static_cast<int>(ids.size()); }
+	bool empty() const { return ids.empty(); }
+	// Ids in dense order
+	std::vector<int>::const_iterator begin() const { return ids.begin(); }
+	std::vector<int>::const_iterator end() const { return ids.end(); }
+	const std::vector<int>& getIds() const { return ids; }
+	// Ids in ascending order, kept up to date by insert() and erase(), so walking them is O(number of nodes)
+	const std::vector<int>& getSortedIds() const { return sortedIds; }
+
+	std::size_t getAllocatedBytes() const { return slots.capacity() * sizeof(Slot) + (ids.capacity() + sortedIds.capacity()) * sizeof(int); }
+
+private:
+	struct Slot
+	{
+		int idx{ -1 };
+		std::uint32_t generation{ 0 };
+	};
+
+	// Indexed by node id
+	std::vector<Slot> slots;
+	// Indexed by dense index
+	std::vector<int> ids;
+	// New nodes usually get the largest id, so they are appended in O(1)
+	std::vector<int> sortedIds;
+};
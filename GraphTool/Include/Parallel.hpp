@@ -0,0 +1,72 @@
+#pragma once
+
+#include <thread>
+#include <algorithm>
+
+enum class ExecutionPolicy
+{
+	Sequential,
+	Parallel
+};
+
+namespace Parallel
+{
+	// Ranges are split into chunks of at least this size, smaller ranges are not worth waking the worker threads for
+	inline constexpr int minChunkSize{ 1024 };
+
+	namespace Impl
+	{
+		// 0 means the number of hardware threads
+		inline int threadsCount{ 0 };
+
+		// Calls task(taskIdx) for every taskIdx in [0, tasksCount) on the worker threads of a pool started by the first call,
+		// the calling thread runs some of the tasks as well. Returns after all the tasks are done.
+		// Calls made from inside a task, or while another thread is using the pool, run all the tasks on the calling thread.
+		void runTasks(int tasksCount, void (*callTask)(void* task, int taskIdx), void* task);
+	}
+
+	// Sets the number of threads used by the parallel algorithms, 0 means the number of hardware threads
+	inline void setThreadsCount(int newThreadsCount)
+	{
+		Impl::threadsCount = std::max(0, newThreadsCount);
+	}
+
+	inline int getThreadsCount()
+	{
+		if (Impl::threadsCount > 0) {
+			return Impl::threadsCount;
+		}
+		return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+	}
+
+	// Splits [begin, end) into one contiguous chunk per thread and calls function(chunkBegin, chunkEnd, chunkIdx) for every chunk,
+	// chunkIdx is in [0, threadsCount), so it can index per-thread state. Chunks run on a persistent pool of worker threads and
+	// the calling thread, ranges too small for more than one chunk run on the calling thread only. Returns after all the chunks
+	// are processed. Ranges of expensive items (like matrix tiles) can use a smaller minimum chunk size.
+	template<typename Function>
+	void parallelFor(int begin, int end, Function&& function, int threadsCount = getThreadsCount(), int chunkMinSize = minChunkSize)
+	{
+		if (begin >= end) {
+			return;
+		}
+
+		chunkMinSize = std::max(1, chunkMinSize);
+		threadsCount = std::clamp((end - begin + chunkMinSize - 1) / chunkMinSize, 1, std::max(1, threadsCount));
+		if (threadsCount == 1) {
+			function(begin, end, 0);
+			return;
+		}
+
+		const int chunkSize{ (end - begin + threadsCount - 1) / threadsCount };
+		auto processChunk = [&function, begin, end, chunkSize](int chunkIdx) {
+			const int chunkBegin{ begin + chunkIdx * chunkSize };
+			const int chunkEnd{ std::min(end, chunkBegin + chunkSize) };
+			if (chunkBegin < chunkEnd) {
+				function(chunkBegin, chunkEnd, chunkIdx);
+			}
+		};
+		Impl::runTasks(threadsCount, [](void* task, int taskIdx) {
+			(*static_cast<decltype(processChunk)*>(task))(taskIdx);
+			}, &processChunk);
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <cstddef>
+
+// Disjoint sets of elements [0, size) merged with union by rank, lookups shorten the paths by halving them
+class UnionFind
+{
+public:
+	explicit UnionFind(int size = 0) { reset(size); }
+
+	// Puts every element into its own set
+	void reset(int size)
+	{
+		parents.resize(size);
+		std::iota(parents.begin(), parents.end(), 0);
+		ranks.assign(size, 0);
+		setsCount = size;
+	}
+
+	// Adds the elements [size(), newSize) in their own sets
+	void grow(int newSize)
+	{
+		for (int element{ size() }; element < newSize; ++element) {
+			parents.push_back(element);
+			ranks.push_back(0);
+			++setsCount;
+		}
+	}
+
+	int find(int element)
+	{
+		while (parents[element] != element) {
+			parents[element] = parents[parents[element]];
+			element = parents[element];
+		}
+		return element;
+	}
+
+	// Same as find() without shortening the paths, union by rank keeps them O(log size) anyway
+	int getRoot(int element) const
+	{
+		while (parents[element] != element) {
+			element = parents[element];
+		}
+		return element;
+	}
+
+	// Returns false if the elements were in the same set already
+	bool unite(int a, int b)
+	{
+		a = find(a);
+		b = find(b);
+		if (a == b) {
+			return false;
+		}
+
+		if (ranks[a] < ranks[b]) {
+			std::swap(a, b);
+		}
+		parents[b] = a;
+		if (ranks[a] == ranks[b]) {
+			++ranks[a];
+		}
+		--setsCount;
+		return true;
+	}
+
+	bool isSameSet(int a, int b) { return find(a) == find(b); }
+
+	int size() const { return static_cast<int>(parents.size()); }
+	int getSetsCount() const { return setsCount; }
+	std::size_t getAllocatedBytes() const { return (parents.capacity() + ranks.capacity()) * sizeof(int); }
+
+private:
+	std::vector<int> parents;
+	std::vector<int> ranks;
+	int setsCount{ 0 };
+};
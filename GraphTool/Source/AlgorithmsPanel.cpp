@@ -3,6 +3,11 @@
 #include <imgui.h>
 #include <iostream>
 #include <string>
+#include <chrono>
+#include <type_traits>
+#include <tuple>
+#include <exception>
+#include <unordered_map>
 #include "../Include/Animations.hpp"
 
 namespace ga = GraphAlgorithms;
@@ -14,6 +19,8 @@ AlgorithmsPanel::AlgorithmsPanel(Graph& graph, GraphEditor& graphEditor)
 
 void AlgorithmsPanel::run()
 {
+	collectResult();
+
 	ImGui::Text("Select Algorithm:");
 	ImGui::Spacing();
 	ImGui::Spacing();
@@ -31,27 +38,38 @@ void AlgorithmsPanel::run()
 		selectedAlgorithm = SelectedAlgorithm::Dijkstra;
 		selectedAlgorithmIdx = 3;
 	}
-	if (ImGui::Selectable("Graph Coloring", selectedAlgorithmIdx == 4)) {
-		selectedAlgorithm = SelectedAlgorithm::Coloring;
+	if (ImGui::Selectable("A* Shortest Path", selectedAlgorithmIdx == 4)) {
+		selectedAlgorithm = SelectedAlgorithm::AStar;
 		selectedAlgorithmIdx = 4;
 	}
-	if (ImGui::Selectable("Find Islands", selectedAlgorithmIdx == 5)) {
-		selectedAlgorithm = SelectedAlgorithm::FindIslands;
+	if (ImGui::Selectable("Graph Coloring", selectedAlgorithmIdx == 5)) {
+		selectedAlgorithm = SelectedAlgorithm::Coloring;
 		selectedAlgorithmIdx = 5;
 	}
-	if (ImGui::Selectable("Kruskal's Minimum Spanning Tree", selectedAlgorithmIdx == 6)) {
-		selectedAlgorithm = SelectedAlgorithm::KruskalMST;
+	if (ImGui::Selectable("Find Islands", selectedAlgorithmIdx == 6)) {
+		selectedAlgorithm = SelectedAlgorithm::FindIslands;
 		selectedAlgorithmIdx = 6;
 	}
-	if (ImGui::Selectable("Nodes Degrees", selectedAlgorithmIdx == 7)) {
-		selectedAlgorithm = SelectedAlgorithm::NodesDegrees;
+	if (ImGui::Selectable("Kruskal's Minimum Spanning Tree", selectedAlgorithmIdx == 7)) {
+		selectedAlgorithm = SelectedAlgorithm::KruskalMST;
 		selectedAlgorithmIdx = 7;
 	}
+	if (ImGui::Selectable("Nodes Degrees", selectedAlgorithmIdx == 8)) {
+		selectedAlgorithm = SelectedAlgorithm::NodesDegrees;
+		selectedAlgorithmIdx = 8;
+	}
+	if (ImGui::Selectable("Eccentricities", selectedAlgorithmIdx == 9)) {
+		selectedAlgorithm = SelectedAlgorithm::Eccentricities;
+		selectedAlgorithmIdx = 9;
+	}
 
 	if (selectedAlgorithmIdx != oldSelectedAlgorithmIdx) {
 		graphEditor.deactivateTraversalOrderAnimation();
 		traversalOrder.reset();
 		nodesColorsIdxs.reset();
+		discardPendingResult = isAlgorithmRunning();
+		showOutdatedResultMessage = false;
+		resultMessage.clear();
 	}
 
 	// Take whole available width
@@ -68,6 +86,9 @@ void AlgorithmsPanel::run()
 	case SelectedAlgorithm::Dijkstra:
 		showDijkstraOptions();
 		break;
+	case SelectedAlgorithm::AStar:
+		showAStarOptions();
+		break;
 	case SelectedAlgorithm::Coloring:
 		showColoringOptions();
 		break;
@@ -80,9 +101,22 @@ void AlgorithmsPanel::run()
 	case SelectedAlgorithm::NodesDegrees:
 		showNodesDegreesOptions();
 		break;
+	case SelectedAlgorithm::Eccentricities:
+		showEccentricitiesOptions();
+		break;
+	}
+
+	if (isAlgorithmRunning()) {
+		ImGui::Text("Running...");
+	}
+	else if (showOutdatedResultMessage) {
+		ImGui::Text("Graph was edited while the algorithm was running, execute it again.");
+	}
+	else if (!resultMessage.empty()) {
+		ImGui::Text(resultMessage.c_str());
 	}
 
-	if (selectedAlgorithmIdx && selectedAlgorithm != SelectedAlgorithm::NodesDegrees) {
+	if (selectedAlgorithmIdx && selectedAlgorithm != SelectedAlgorithm::NodesDegrees && selectedAlgorithm != SelectedAlgorithm::Eccentricities) {
 		ImGui::Separator();
 		loopAnimationCheckBox();
 
@@ -101,6 +135,75 @@ void AlgorithmsPanel::reset()
 	endNode = 0;
 }
 
+template<typename Function>
+void AlgorithmsPanel::execute(Function&& algorithm)
+{
+	// Future returned by std::async blocks in its destructor, so only one algorithm can run at a time
+	if (isAlgorithmRunning()) {
+		return;
+	}
+
+	discardPendingResult = false;
+	showOutdatedResultMessage = false;
+	resultMessage.clear();
+	pendingResult = std::async(std::launch::async, [snapshot{ graph.snapshot() }, algorithm{ std::forward<Function>(algorithm) }]() {
+		AlgorithmResult result;
+
+		auto output{ algorithm(*snapshot) };
+		if constexpr (std::is_same_v<decltype(output), AlgorithmResult>) {
+			result = std::move(output);
+		}
+		else if constexpr (std::is_same_v<decltype(output), ga::TraversalOrder>) {
+			result.traversalOrder = std::move(output);
+		}
+		else if constexpr (std::is_same_v<decltype(output.second), std::string>) {
+			result.traversalOrder = std::move(output.first);
+			result.message = std::move(output.second);
+		}
+		else {
+			result.traversalOrder = std::move(output.first);
+			result.nodesColorsIdxs = std::move(output.second);
+		}
+		result.graphVersion = snapshot->getVersion();
+		return result;
+		});
+}
+
+void AlgorithmsPanel::collectResult()
+{
+	if (!isAlgorithmRunning() || pendingResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+		return;
+	}
+
+	AlgorithmResult result;
+	try {
+		result = pendingResult.get();
+	}
+	catch (const std::exception& exception) {
+		if (!discardPendingResult) {
+			resultMessage = std::string("Algorithm failed: ") + exception.what();
+		}
+		return;
+	}
+	if (discardPendingResult) {
+		return;
+	}
+
+	// Nodes and edges from the result might not exist anymore
+	if (result.graphVersion != graph.version()) {
+		showOutdatedResultMessage = true;
+		return;
+	}
+
+	resultMessage = result.message;
+	if (result.nodesColorsIdxs.has_value()) {
+		graphEditor.activateTraversalOrderAnimation(result.traversalOrder, *result.nodesColorsIdxs);
+	}
+	else {
+		graphEditor.activateTraversalOrderAnimation(result.traversalOrder);
+	}
+}
+
 void AlgorithmsPanel::selectNodeCombo(const std::vector<std::string>& nodesIds, int& outNodeIdx, const char* label)
 {
 	ImGui::Text(std::string(std::string(label) + std::string(":")).c_str());
@@ -144,8 +247,7 @@ void AlgorithmsPanel::showDfsOptions()
 	selectNodeCombo(nodesIds, startNode);
 
 	if (ImGui::Button("Execute") && !nodesIds.empty()) {
-		const auto traversalOrder{ ga::dfs(graph, std::stoi(nodesIds[startNode])) };
-		graphEditor.activateTraversalOrderAnimation(traversalOrder);
+		execute([startNodeId{ std::stoi(nodesIds[startNode]) }](const GraphSnapshot& snapshot) { return ga::dfs(snapshot, startNodeId); });
 	}
 }
 
@@ -155,8 +257,7 @@ void AlgorithmsPanel::showBfsOptions()
 	selectNodeCombo(nodesIds, startNode);
 
 	if (ImGui::Button("Execute") && !nodesIds.empty()) {
-		const auto traversalOrder{ ga::bfs(graph, std::stoi(nodesIds[startNode])) };
-		graphEditor.activateTraversalOrderAnimation(traversalOrder);
+		execute([startNodeId{ std::stoi(nodesIds[startNode]) }](const GraphSnapshot& snapshot) { return ga::bfs(snapshot, startNodeId); });
 	}
 }
 
@@ -167,39 +268,100 @@ void AlgorithmsPanel::showDijkstraOptions()
 	selectNodeCombo(nodesIds, endNode, "Target");
 
 	if (ImGui::Button("Execute") && !nodesIds.empty()) {
-		const auto traversalOrder{ ga::dijkstra(graph, std::stoi(nodesIds[startNode]), std::stoi(nodesIds[endNode])) };
-		graphEditor.activateTraversalOrderAnimation(traversalOrder);
+		execute([startNodeId{ std::stoi(nodesIds[startNode]) }, endNodeId{ std::stoi(nodesIds[endNode]) }](const GraphSnapshot& snapshot) {
+			return ga::dijkstra(snapshot, startNodeId, endNodeId);
+			});
+	}
+}
+
+void AlgorithmsPanel::showAStarOptions()
+{
+	const auto nodesIds{ graph.getNodesIdsStrings() };
+	selectNodeCombo(nodesIds, startNode);
+	selectNodeCombo(nodesIds, endNode, "Target");
+
+	if (ImGui::Button("Execute") && !nodesIds.empty()) {
+		// Positions are copied, because the nodes can be moved while the algorithm is running
+		std::unordered_map<int, std::pair<float, float>> nodesPositions;
+		nodesPositions.reserve(graphEditor.getNodesShapes().size());
+		for (const GraphNodeShape& nodeShape : graphEditor.getNodesShapes()) {
+			const sf::Vector2f position{ nodeShape.getShape().getPosition() };
+			nodesPositions.emplace(nodeShape.getNodeId(), std::pair{ position.x, position.y });
+		}
+
+		execute([startNodeId{ std::stoi(nodesIds[startNode]) }, endNodeId{ std::stoi(nodesIds[endNode]) }, nodesPositions{ std::move(nodesPositions) }](const GraphSnapshot& snapshot) {
+			ga::SearchStatistics aStarStatistics;
+			ga::TraversalOrder traversalOrder{ ga::aStar(snapshot, startNodeId, endNodeId, [&nodesPositions](int nodeId) { return nodesPositions.at(nodeId); }, &aStarStatistics) };
+			ga::SearchStatistics dijkstraStatistics;
+			ga::dijkstra(snapshot, startNodeId, endNodeId, ga::ShortestPathQueue::Automatic, &dijkstraStatistics);
+
+			std::string message{ "Expanded nodes: " + std::to_string(aStarStatistics.expandedNodesCount)
+				+ " (Dijkstra: " + std::to_string(dijkstraStatistics.expandedNodesCount) + ")" };
+			return std::pair{ std::move(traversalOrder), std::move(message) };
+			});
 	}
 }
 
 void AlgorithmsPanel::showColoringOptions()
 {
+	ImGui::Text("Strategy: ");
+	ImGui::Combo("##ColoringStrategy", &coloringStrategyIdx, "Greedy\0Smallest Last\0DSatur\0Jones-Plassmann (parallel)\0");
+
 	if (ImGui::Button("Execute")) {
-		const auto [traversalOrder, nodesColorsIdxs] { ga::coloring(graph) };
-		graphEditor.activateTraversalOrderAnimation(traversalOrder, nodesColorsIdxs);
+		execute([strategy{ static_cast<ga::ColoringStrategy>(coloringStrategyIdx) }](const GraphSnapshot& snapshot) {
+			AlgorithmResult result;
+			std::tie(result.traversalOrder, result.nodesColorsIdxs) = ga::coloring(snapshot, strategy);
+
+			int colorsCount{ 0 };
+			for (const auto& [nodeId, colorIdx] : *result.nodesColorsIdxs) {
+				colorsCount = std::max(colorsCount, colorIdx.value_or(0) + 1);
+			}
+			result.message = "Colors used: " + std::to_string(colorsCount);
+			return result;
+			});
 	}
 }
 
 void AlgorithmsPanel::showFindIslandsOptions()
 {
-	if (ImGui::Button("Execute")) {
-		const auto [traversalOrder, nodesColorsIdxs] { ga::findIslands(graph) };
-		graphEditor.activateTraversalOrderAnimation(traversalOrder, nodesColorsIdxs);
+	// Islands are kept up to date by the graph, so they are read right away instead of being computed in the background
+	if (ImGui::Button("Execute") && !isAlgorithmRunning()) {
+		showOutdatedResultMessage = false;
+		resultMessage.clear();
+		const auto [islandsTraversalOrder, islandsColorsIdxs] { ga::findIslands(graph) };
+		graphEditor.activateTraversalOrderAnimation(islandsTraversalOrder, islandsColorsIdxs);
 	}
 }
 
 void AlgorithmsPanel::showKruskalMSTOptions()
 {
 	if (ImGui::Button("Execute")) {
-		const auto traversalOrder{ ga::kruskalMST(graph) };
-		graphEditor.activateTraversalOrderAnimation(traversalOrder);
+		execute([](const GraphSnapshot& snapshot) { return ga::kruskalMST(snapshot); });
 	}
 }
 
 void AlgorithmsPanel::showNodesDegreesOptions()
 {
 	if (ImGui::Button("Execute")) {
-		const auto [traversalOrder, nodesColorsIdxs] { ga::nodesDegrees(graph) };
-		graphEditor.activateTraversalOrderAnimation(traversalOrder, nodesColorsIdxs);
+		execute([](const GraphSnapshot& snapshot) { return ga::nodesDegrees(snapshot); });
+	}
+}
+
+void AlgorithmsPanel::showEccentricitiesOptions()
+{
+	if (graph.getNodes().size() > ga::eccentricitiesMaxNodesCount) {
+		ImGui::Text(("Distance matrix is too large for more than " + std::to_string(ga::eccentricitiesMaxNodesCount) + " nodes").c_str());
+		return;
+	}
+
+	if (ImGui::Button("Execute")) {
+		execute([](const GraphSnapshot& snapshot) {
+			AlgorithmResult result;
+			ga::DistancesSummary summary;
+			std::tie(result.traversalOrder, result.nodesColorsIdxs) = ga::eccentricities(snapshot, &summary);
+			result.message = summary.hasNegativeCycle ? "Graph has a negative cycle" :
+				"Diameter: " + std::to_string(summary.diameter) + ", Radius: " + std::to_string(summary.radius);
+			return result;
+			});
 	}
 }
@@ -104,11 +104,11 @@ void EditPanel::saveGraphToFile(const std::string& name)
 		file << nodeShape.getNodeId() << " " << static_cast<int>(nodeShape.getShape().getPosition().x) << " " << static_cast<int>(nodeShape.getShape().getPosition().y) << " ";
 	}
 	file << '\n';
-	for (const Edge& edge : graph.getDirectedEdges()) {
+	for (const Edge& edge : graph.buildDirectedEdges()) {
 		file << edge.a << " " << edge.b << " " << edge.weight << " ";
 	}
 	file << '\n';
-	for (const Edge& edge : graph.getUndirectedEdges()) {
+	for (const Edge& edge : graph.buildUndirectedEdges()) {
 		file << edge.a << " " << edge.b << " " << edge.weight << " ";
 	}
 
@@ -170,29 +170,19 @@ void EditPanel::loadGraphFromFile(const std::string& name)
 			std::getline(file, line);
 			const std::vector<int> undirectedEdges{ splitLine() };
 
+			std::vector<Edge> edges;
+			edges.reserve(directedEdges.size() / 3);
 			for (int i{ 0 }; i < directedEdges.size(); i += 3) {
-				auto[directedEdgeShape, undirectedEdgeShape] = graphEditor.createNewEdge(directedEdges[i], directedEdges[i + 1]);
-				// Update directed edge weight
-				if (const int directedEdgeWeight{ directedEdges[i + 2] }; directedEdgeWeight != 0) {
-					graph.setEdgeWeight(directedEdges[i], directedEdges[i + 1], directedEdgeWeight, Directed::Yes);
-					directedEdgeShape->setWeight(directedEdgeWeight);
-				}
-
-				if (!undirectedEdgeShape) {
-					continue;
-				}
-
-				// Update undirected edge weight
-				for (int j{ 0 }; j < undirectedEdges.size(); j += 3) {
-					if (const int undirectedEdgeWeight{ undirectedEdges[j + 2] }; undirectedEdgeWeight != 0) {
-						if ((undirectedEdgeShape->getStartNodeId() == undirectedEdges[j] && undirectedEdgeShape->getEndNodeId() == undirectedEdges[j + 1])
-							|| (undirectedEdgeShape->getStartNodeId() == undirectedEdges[j + 1] && undirectedEdgeShape->getEndNodeId() == undirectedEdges[j])) {
-							graph.setEdgeWeight(undirectedEdgeShape->getStartNodeId(), undirectedEdgeShape->getEndNodeId(), undirectedEdgeWeight, Directed::No);
-							undirectedEdgeShape->setWeight(undirectedEdgeWeight);
-						}
-					}
-				}
+				edges.push_back(Edge{ directedEdges[i], directedEdges[i + 1], directedEdges[i + 2] });
 			}
+			graph.addEdges(std::move(edges));
+
+			// Update undirected edges weights
+			for (int i{ 0 }; i < undirectedEdges.size(); i += 3) {
+				graph.setEdgeWeight(undirectedEdges[i], undirectedEdges[i + 1], undirectedEdges[i + 2], Directed::No);
+			}
+
+			graphEditor.createEdgesShapes();
 		}
 
 		++lineIdx;
@@ -1,8 +1,19 @@
 #include "../Include/Graph.hpp"
+#include "../Include/GraphSnapshot.hpp"
 #include <iostream>
 #include <string>
-
-Graph::Graph()
+#include <iterator>
+#include <array>
+#include <unordered_set>
+
+Graph::Graph(std::pmr::memory_resource* upstreamMemoryResource)
+	: reservedMemory{ upstreamMemoryResource }
+	, memoryPool{ &reservedMemory }
+	, usedMemory{ &memoryPool }
+	, directedAdjList{ &usedMemory }
+	, reversedAdjList{ &usedMemory }
+	, directedEdgesWeights{ &usedMemory }
+	, undirectedEdgesWeights{ &usedMemory }
 {
 
 }
@@ -13,14 +24,58 @@ void Graph::addEdge(int a, int b)
 		return;
 	}
 
-	// Create edge
-	directedEdges.insert(Edge{ a, b, 0 });
-	undirectedEdges.insert(Edge{ std::min(a, b), std::max(a, b), 0 });
+	// Create edge, if there was no edge between the nodes the undirected edge is created with weight 0 as well
+	if (directedEdgesWeights.insert(a, b, 0)) {
+		directedAdjList[a].insert(b);
+		reversedAdjList[b].insert(a);
+		journal.record(GraphChange::Type::DirectedEdgeAdded, a, b);
+		components.unite(nodesLabels[nodes.getIdx(a)], nodesLabels[nodes.getIdx(b)]);
+	}
+}
+
+void Graph::addEdges(std::vector<Edge> edges)
+{
+	edges.erase(std::remove_if(edges.begin(), edges.end(), [this](const Edge& edge) {
+		return !doesNodeExist(edge.a) || !doesNodeExist(edge.b);
+		}), edges.end());
+	// Stable sort keeps the first of the duplicated edges, like adding them one by one would
+	std::stable_sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+	// Edges are sorted, so inserting each one right after the previous one makes the insertions amortized O(1)
+	auto insertRows = [](AdjacencyList& adjList, const std::vector<std::pair<int, int>>& connections) {
+		auto rowHint{ adjList.begin() };
+		for (std::size_t i{ 0 }; i < connections.size();) {
+			// Rows are emplaced, so their sets get the allocator of the adjacency list
+			auto row{ adjList.try_emplace(rowHint, connections[i].first) };
+			rowHint = std::next(row);
+			auto hint{ row->second.begin() };
+			for (; i < connections.size() && connections[i].first == row->first; ++i) {
+				hint = std::next(row->second.insert(hint, connections[i].second));
+			}
+		}
+	};
 
-	// Update adjacency lists
-	directedAdjList[a].insert(b);
-	undirectedAdjList[a].insert(b);
-	undirectedAdjList[b].insert(a);
+	directedEdgesWeights.reserve(directedEdgesWeights.size() + edges.size());
+	std::vector<std::pair<int, int>> connections;
+	connections.reserve(edges.size());
+	for (const Edge& edge : edges) {
+		if (directedEdgesWeights.insert(edge.a, edge.b, edge.weight)) {
+			connections.push_back({ edge.a, edge.b });
+			journal.record(GraphChange::Type::DirectedEdgeAdded, edge.a, edge.b, edge.weight);
+		}
+	}
+
+	for (const auto& [a, b] : connections) {
+		components.unite(nodesLabels[nodes.getIdx(a)], nodesLabels[nodes.getIdx(b)]);
+	}
+	insertRows(directedAdjList, connections);
+
+	for (auto& [a, b] : connections) {
+		std::swap(a, b);
+	}
+	std::sort(connections.begin(), connections.end());
+	insertRows(reversedAdjList, connections);
 }
 
 void Graph::setEdgeWeight(int a, int b, int newWeight)
@@ -34,11 +89,25 @@ void Graph::setEdgeWeight(int a, int b, int newWeight, Directed directed)
 		return;
 	}
 
-	if (doesDirectedEdgeExist(a, b) && directed == Directed::Yes) {
-		directedEdges.find(Edge{ a, b })->weight = newWeight;
+	if (directed == Directed::Yes) {
+		if (int* weight{ directedEdgesWeights.find(a, b) }; weight && *weight != newWeight) {
+			*weight = newWeight;
+			journal.record(GraphChange::Type::DirectedWeightChanged, a, b, newWeight);
+		}
 	}
-	else if (doesUndirectedEdgeExist(a, b) && directed == Directed::No) {
-		undirectedEdges.find(Edge{ std::min(a, b), std::max(a, b) })->weight = newWeight;
+	else if (doesUndirectedEdgeExist(a, b) && getUndirectedEdgeWeight(a, b) != newWeight) {
+		const int minId{ std::min(a, b) };
+		const int maxId{ std::max(a, b) };
+		journal.record(GraphChange::Type::UndirectedWeightChanged, minId, maxId, newWeight);
+		if (newWeight == 0) {
+			undirectedEdgesWeights.erase(minId, maxId);
+		}
+		else if (int* weight{ undirectedEdgesWeights.find(minId, maxId) }) {
+			*weight = newWeight;
+		}
+		else {
+			undirectedEdgesWeights.insert(minId, maxId, newWeight);
+		}
 	}
 }
 
@@ -47,25 +116,33 @@ int Graph::getEdgeWeight(int a, int b) const
 	if (!doesEdgeExist(a, b)) {
 		return 0;
 	}
-
-	if (isWeighted()) {
-		if (isDirected()) {
-			return directedEdges.find({ a, b })->weight;
-		}
-		else {
-			return undirectedEdges.find({ std::min(a, b), std::max(a, b) })->weight;
-		}
-	}
-	else {
+	if (!isWeighted()) {
 		return 1;
 	}
+
+	return isDirected() ? *directedEdgesWeights.find(a, b) : getUndirectedEdgeWeight(a, b);
 }
 
 int Graph::createNode()
 {
-	Node node{ nextNodeId++ };
-	nodes.insert(std::move(node));
-	return nextNodeId - 1;
+	const int nodeId{ nextNodeId++ };
+	if (!doesNodeExist(nodeId)) {
+		nodes.insert(nodeId);
+		nodesLabels.push_back(createComponentLabel());
+		journal.record(GraphChange::Type::NodeCreated, nodeId);
+	}
+	return nodeId;
+}
+
+int Graph::createNodes(int count)
+{
+	const int firstNodeId{ nextNodeId };
+	nodes.reserve(nodes.size() + count, firstNodeId + count);
+	nodesLabels.reserve(nodesLabels.size() + count);
+	for (int i{ 0 }; i < count; ++i) {
+		createNode();
+	}
+	return firstNodeId;
 }
 
 void Graph::setNextNodeId(int newNextNodeId)
@@ -79,34 +156,71 @@ void Graph::deleteNode(int nodeId)
 		return;
 	}
 
+	// Labels follow the dense indices, which move the last node into the place of the erased one
+	nodesLabels[nodes.getIdx(nodeId)] = nodesLabels.back();
+	nodesLabels.pop_back();
 	nodes.erase(nodeId);
 
-	auto updateAdjList = [nodeId](auto& adjList) {
-		adjList.erase(nodeId);
-		for (auto& [id, connectedIds] : adjList) {
-			connectedIds.erase(nodeId);
-		}
-	};
-	updateAdjList(directedAdjList);
-	updateAdjList(undirectedAdjList);
-
 	std::vector<std::pair<int, int>> deletedDirectedEdges;
 	std::vector<std::pair<int, int>> deletedUndirectedEdges;
 
-	auto deleteEdges = [nodeId](auto& edges, auto& deletedEdges) {
-		auto it{ edges.begin() };
-		while (it != edges.end()) {
-			if (it->a == nodeId || it->b == nodeId) {
-				deletedEdges.push_back({ it->a, it->b });
-				it = edges.erase(it);
+	// Rows of the node contain every node connected to it by an edge in any direction,
+	// so only the rows of these nodes have to be updated
+	std::vector<int> outgoingNeighbors;
+	if (auto row{ directedAdjList.extract(nodeId) }) {
+		outgoingNeighbors.assign(row.mapped().begin(), row.mapped().end());
+	}
+	std::vector<int> incomingNeighbors;
+	if (auto row{ reversedAdjList.extract(nodeId) }) {
+		incomingNeighbors.assign(row.mapped().begin(), row.mapped().end());
+	}
+
+	for (const int connectedId : outgoingNeighbors) {
+		directedEdgesWeights.erase(nodeId, connectedId);
+		deletedDirectedEdges.push_back({ nodeId, connectedId });
+		if (const auto it{ reversedAdjList.find(connectedId) }; it != reversedAdjList.end()) {
+			it->second.erase(nodeId);
+		}
+	}
+	for (const int connectedId : incomingNeighbors) {
+		// Self loop was already deleted with the outgoing edges
+		if (connectedId != nodeId) {
+			directedEdgesWeights.erase(connectedId, nodeId);
+			deletedDirectedEdges.push_back({ connectedId, nodeId });
+			if (const auto it{ directedAdjList.find(connectedId) }; it != directedAdjList.end()) {
+				it->second.erase(nodeId);
 			}
-			else {
-				++it;
+		}
+	}
+
+	std::vector<int> connectedNodes;
+	std::set_union(outgoingNeighbors.begin(), outgoingNeighbors.end(), incomingNeighbors.begin(), incomingNeighbors.end(), std::back_inserter(connectedNodes));
+	for (const int connectedId : connectedNodes) {
+		const int minId{ std::min(nodeId, connectedId) };
+		const int maxId{ std::max(nodeId, connectedId) };
+		undirectedEdgesWeights.erase(minId, maxId);
+		deletedUndirectedEdges.push_back({ minId, maxId });
+	}
+
+	// Keep the order in which the edges are sorted
+	std::sort(deletedDirectedEdges.begin(), deletedDirectedEdges.end());
+
+	for (const auto& [a, b] : deletedDirectedEdges) {
+		journal.record(GraphChange::Type::DirectedEdgeDeleted, a, b);
+	}
+	// Neighbors might end up in different components, each one is checked against the earlier ones still sharing its component
+	for (std::size_t i{ 0 }; i < connectedNodes.size(); ++i) {
+		if (connectedNodes[i] == nodeId) {
+			continue;
+		}
+		for (std::size_t j{ 0 }; j < i; ++j) {
+			if (connectedNodes[j] != nodeId && sameComponent(connectedNodes[j], connectedNodes[i])
+				&& !splitComponent(connectedNodes[j], connectedNodes[i])) {
+				break;
 			}
 		}
-	};
-	deleteEdges(directedEdges, deletedDirectedEdges);
-	deleteEdges(undirectedEdges, deletedUndirectedEdges);
+	}
+	journal.record(GraphChange::Type::NodeDeleted, nodeId);
 
 	onDirectedEdgesDeleted.emit(std::move(deletedDirectedEdges));
 	onUndirectedEdgesDeleted.emit(std::move(deletedUndirectedEdges));
@@ -118,81 +232,38 @@ void Graph::deleteEdge(int a, int b)
 		return;
 	}
 
-	auto updateAdjList = [a, b](auto& adjList) {
-		for (auto& [id, connectedIds] : adjList) {
-			if (id == a || id == b) {
-				auto it{ connectedIds.begin() };
-				while (it != connectedIds.end()) {
-					if ((id == a && *it == b) || (id == b && *it == a)) {
-						it = connectedIds.erase(it);
-					}
-					else {
-						++it;
-					}
-				}
-			}
-		}
-	};
-
-	auto deleteEdges = [a, b](auto& edges, auto& deletedEdges) {
-		auto it{ edges.begin() };
-		while (it != edges.end()) {
-			if ((it->a == a && it->b == b) || (it->a == b && it->b == a)) {
-				deletedEdges.push_back({ it->a, it->b });
-				it = edges.erase(it);
-			}
-			else {
-				++it;
-			}
-		}
-	};
-
 	std::vector<std::pair<int, int>> deletedDirectedEdges;
 	std::vector<std::pair<int, int>> deletedUndirectedEdges;
 
-	if (isDirected()) {
-		// If there exists another edge connecting the A and B nodes, don't delete the undirected edge connecting them
-		if (doesDirectedEdgeExist(b, a)) {
-			for (auto& [id, connectedIds] : directedAdjList) {
-				if (id == a) {
-					auto it{ connectedIds.begin() };
-					while (it != connectedIds.end()) {
-						if (*it == b) {
-							it = connectedIds.erase(it);
-						}
-						else {
-							++it;
-						}
-					}
-				}
-			}
-
-			auto it{ directedEdges.begin() };
-			while (it != directedEdges.end()) {
-				if (it->a == a && it->b == b) {
-					deletedDirectedEdges.push_back({ a, b });
-					it = directedEdges.erase(it);
-				}
-				else {
-					++it;
-				}
-			}
+	// If graph is directed and there exists another edge connecting the A and B nodes, don't delete the undirected edge connecting them
+	if (isDirected() && a != b && doesDirectedEdgeExist(b, a)) {
+		if (eraseDirectedEdge(a, b)) {
+			deletedDirectedEdges.push_back({ a, b });
 		}
-		else {
-			updateAdjList(directedAdjList);
-			updateAdjList(undirectedAdjList);
+	}
+	// Otherwise delete all directed edges connecting the A and B nodes
+	else {
+		const int minId{ std::min(a, b) };
+		const int maxId{ std::max(a, b) };
+		const bool undirectedEdgeExisted{ doesUndirectedEdgeExist(minId, maxId) };
 
-			deleteEdges(directedEdges, deletedDirectedEdges);
-			deleteEdges(undirectedEdges, deletedUndirectedEdges);
+		if (eraseDirectedEdge(minId, maxId)) {
+			deletedDirectedEdges.push_back({ minId, maxId });
+		}
+		if (minId != maxId && eraseDirectedEdge(maxId, minId)) {
+			deletedDirectedEdges.push_back({ maxId, minId });
+		}
+		if (undirectedEdgeExisted) {
+			undirectedEdgesWeights.erase(minId, maxId);
+			deletedUndirectedEdges.push_back({ minId, maxId });
 		}
 	}
-	// If graph is undirected, delete all directed edges connecting the A and B nodes
-	else {
-		updateAdjList(directedAdjList);
-		updateAdjList(undirectedAdjList);
 
-		deleteEdges(directedEdges, deletedDirectedEdges);
-		deleteEdges(undirectedEdges, deletedUndirectedEdges);
+	for (const auto& [a, b] : deletedDirectedEdges) {
+		journal.record(GraphChange::Type::DirectedEdgeDeleted, a, b);
+	}
+	if (!deletedDirectedEdges.empty() && a != b && !doesUndirectedEdgeExist(a, b)) {
+		splitComponent(a, b);
 	}
 
 	onDirectedEdgesDeleted.emit(std::move(deletedDirectedEdges));
@@ -206,19 +277,37 @@ void Graph::reset()
 	nextNodeId = 1;
 	nodes.clear();
 	directedAdjList.clear();
-	undirectedAdjList.clear();
-	directedEdges.clear();
-	undirectedEdges.clear();
+	reversedAdjList.clear();
+	directedEdgesWeights.clear();
+	undirectedEdgesWeights.clear();
+	lastSnapshot.reset();
+	nodesLabels.clear();
+	components.reset(0);
+
+	// All the containers are empty now, so the whole pool can be given back instead of keeping its chunks cached
+	memoryPool.release();
+
+	journal.record(GraphChange::Type::Cleared);
 }
 
 void Graph::makeDirected()
 {
+	if (isDirected()) {
+		return;
+	}
+
 	directed = Directed::Yes;
+	journal.record(GraphChange::Type::DirectedModeChanged, 1);
 }
 
 void Graph::makeUndirected()
 {
+	if (!isDirected()) {
+		return;
+	}
+
 	directed = Directed::No;
+	journal.record(GraphChange::Type::DirectedModeChanged, 0);
 }
 
 void Graph::makeWeighted()
@@ -228,6 +317,7 @@ void Graph::makeWeighted()
 	}
 
 	weighted = Weighted::Yes;
+	journal.record(GraphChange::Type::WeightedModeChanged, 1);
 	onWeightedValueChanged.emit();
 }
 
@@ -238,12 +328,13 @@ void Graph::makeUnweighted()
 	}
 
 	weighted = Weighted::No;
+	journal.record(GraphChange::Type::WeightedModeChanged, 0);
 	onWeightedValueChanged.emit();
 }
 
 bool Graph::doesNodeExist(int nodeId) const
 {
-	return nodes.find(nodeId) != nodes.end();
+	return nodes.contains(nodeId);
 }
 
 bool Graph::doesEdgeExist(int a, int b) const
@@ -251,21 +342,181 @@ bool Graph::doesEdgeExist(int a, int b) const
 	return isDirected() ? doesDirectedEdgeExist(a, b) : doesUndirectedEdgeExist(a, b);
 }
 
+Graph::AdjacencyList Graph::buildAdjacencyList() const
+{
+	AdjacencyList adjList;
+	for (const int nodeId : nodes.getSortedIds()) {
+		auto& row{ adjList.try_emplace(adjList.end(), nodeId)->second };
+		forEachNeighbor(nodeId, [&row](int neighborId, int) {
+			row.insert(row.end(), neighborId);
+			});
+	}
+	return adjList;
+}
+
+std::vector<Edge> Graph::buildDirectedEdges() const
+{
+	std::vector<Edge> edges;
+	edges.reserve(directedEdgesWeights.size());
+	for (const auto& [a, row] : directedAdjList) {
+		for (const int b : row) {
+			edges.push_back(Edge{ a, b, *directedEdgesWeights.find(a, b) });
+		}
+	}
+	return edges;
+}
+
+std::vector<Edge> Graph::buildUndirectedEdges() const
+{
+	std::vector<Edge> edges;
+	edges.reserve(directedEdgesWeights.size());
+	for (const int nodeId : nodes.getSortedIds()) {
+		// Take every edge only once, from the row of its smaller node
+		forEachUndirectedNeighbor(nodeId, [&edges, nodeId](int neighborId, int weight) {
+			if (nodeId <= neighborId) {
+				edges.push_back(Edge{ nodeId, neighborId, weight });
+			}
+			});
+	}
+	return edges;
+}
+
+const std::pmr::set<int>& Graph::getOutNeighbors(int nodeId) const
+{
+	static const std::pmr::set<int> emptyRow;
+	const auto it{ directedAdjList.find(nodeId) };
+	return it != directedAdjList.end() ? it->second : emptyRow;
+}
+
+const std::pmr::set<int>& Graph::getInNeighbors(int nodeId) const
+{
+	static const std::pmr::set<int> emptyRow;
+	const auto it{ reversedAdjList.find(nodeId) };
+	return it != reversedAdjList.end() ? it->second : emptyRow;
+}
+
 std::vector<std::string> Graph::getNodesIdsStrings() const
 {
 	std::vector<std::string> result;
-	for (const Node& node : nodes) {
-		result.push_back(std::to_string(node.id));
+	for (const int nodeId : nodes.getSortedIds()) {
+		result.push_back(std::to_string(nodeId));
 	}
 	return result;
 }
 
+Graph::MemoryUsage Graph::getMemoryUsage() const
+{
+	std::size_t unpooledBytes{ nodes.getAllocatedBytes() + nodesLabels.capacity() * sizeof(int) + components.getAllocatedBytes() + journal.getAllocatedBytes() };
+	{
+		const std::lock_guard<std::mutex> lock{ lastSnapshotMutex };
+		if (lastSnapshot) {
+			unpooledBytes += lastSnapshot->getAllocatedBytes();
+		}
+	}
+	return { usedMemory.getAllocatedBytes(), reservedMemory.getAllocatedBytes(), unpooledBytes };
+}
+
+std::shared_ptr<const GraphSnapshot> Graph::snapshot() const
+{
+	// Users of the previous snapshot keep it alive, the graph only drops its own reference
+	const std::lock_guard<std::mutex> lock{ lastSnapshotMutex };
+	if (!lastSnapshot || lastSnapshot->getVersion() != version()) {
+		lastSnapshot = std::make_shared<const GraphSnapshot>(*this);
+	}
+	return lastSnapshot;
+}
+
+bool Graph::sameComponent(int a, int b) const
+{
+	const int componentIdA{ getComponentId(a) };
+	return componentIdA != -1 && componentIdA == getComponentId(b);
+}
+
+int Graph::getComponentId(int nodeId) const
+{
+	const int idx{ nodes.getIdx(nodeId) };
+	return idx == -1 ? -1 : components.getRoot(nodesLabels[idx]);
+}
+
 bool Graph::doesDirectedEdgeExist(int a, int b) const
 {
-	return directedEdges.find({ a, b }) != directedEdges.end();
+	return directedEdgesWeights.contains(a, b);
 }
 
 bool Graph::doesUndirectedEdgeExist(int a, int b) const
 {
-	return undirectedEdges.find({ std::min(a, b), std::max(a, b) }) != undirectedEdges.end();
+	return directedEdgesWeights.contains(a, b) || directedEdgesWeights.contains(b, a);
+}
+
+bool Graph::eraseDirectedEdge(int a, int b)
+{
+	if (!directedEdgesWeights.erase(a, b)) {
+		return false;
+	}
+
+	if (const auto it{ directedAdjList.find(a) }; it != directedAdjList.end()) {
+		it->second.erase(b);
+	}
+	if (const auto it{ reversedAdjList.find(b) }; it != reversedAdjList.end()) {
+		it->second.erase(a);
+	}
+	return true;
+}
+
+bool Graph::splitComponent(int a, int b)
+{
+	// Both searches take a step in turns, so if the component was split, the work is bounded by the size of the smaller part
+	std::array<std::unordered_set<int>, 2> visited{ { { a }, { b } } };
+	std::array<std::vector<int>, 2> queues{ { { a }, { b } } };
+	std::array<std::size_t, 2> queuesHeads{ 0, 0 };
+	for (int side{ 0 };; side = 1 - side) {
+		if (queuesHeads[side] == queues[side].size()) {
+			// Whole part was visited without meeting the other search
+			const int label{ createComponentLabel() };
+			for (const int nodeId : queues[side]) {
+				nodesLabels[nodes.getIdx(nodeId)] = label;
+			}
+			return true;
+		}
+
+		const int nodeId{ queues[side][queuesHeads[side]++] };
+		for (const std::pmr::set<int>* row : { &getOutNeighbors(nodeId), &getInNeighbors(nodeId) }) {
+			for (const int neighborId : *row) {
+				if (visited[1 - side].count(neighborId) != 0) {
+					return false;
+				}
+				if (visited[side].insert(neighborId).second) {
+					queues[side].push_back(neighborId);
+				}
+			}
+		}
+	}
+}
+
+int Graph::createComponentLabel()
+{
+	// Deleted nodes and split components leave unused labels behind, renumbering the used ones keeps the labels O(nodes)
+	if (components.size() > 2 * nodes.size() + 64) {
+		std::vector<int> newLabels(components.size(), -1);
+		UnionFind newComponents;
+		for (int& label : nodesLabels) {
+			int& newLabel{ newLabels[components.find(label)] };
+			if (newLabel == -1) {
+				newLabel = newComponents.size();
+				newComponents.grow(newLabel + 1);
+			}
+			label = newLabel;
+		}
+		components = std::move(newComponents);
+	}
+
+	const int label{ components.size() };
+	components.grow(label + 1);
+	return label;
+}
+
+int Graph::getUndirectedEdgeWeight(int a, int b) const
+{
+	const int* weight{ undirectedEdgesWeights.find(std::min(a, b), std::max(a, b)) };
+	return weight ? *weight : 0;
 }
@@ -1,289 +1,1945 @@
 #include "../Include/GraphAlgorithms.hpp"
+#include "../Include/UnionFind.hpp"
+#include "../Include/IndexedHeap.hpp"
 #include <queue>
+#include <random>
 #include <optional>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <numeric>
+#include <cmath>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include <algorithm>
 #include <iostream>
 
 namespace GraphAlgorithms
 {
-	using VisitedNodes = std::map<int, bool>;
+	// Indexed by snapshot node indices
+	using VisitedNodes = std::vector<bool>;
 
 	namespace Helpers
 	{
-		VisitedNodes createEmptyVisitedNodesContainer(const Graph& graph)
+		VisitedNodes createEmptyVisitedNodesContainer(const GraphSnapshot& graph)
 		{
-			VisitedNodes visitedNodes;
-			for (const Node& node : graph.getNodes()) {
-				visitedNodes.emplace(node.id, false);
+			return VisitedNodes(graph.getNodesCount(), false);
+		}
+
+		// There is a bucket for every weight, so larger weights fall back to the binary heap even if the bucket queue is requested
+		bool useBucketQueue(const GraphSnapshot& graph, ShortestPathQueue queue)
+		{
+			return queue != ShortestPathQueue::BinaryHeap && graph.getMinWeight() >= 0 && graph.getMaxWeight() <= bucketQueueMaxWeight;
+		}
+
+		// Nodes are listed by island, in ascending id order inside an island. nodesIds have to be ascending.
+		std::pair<TraversalOrder, NodesColorsIdxs> createIslandsResult(const std::vector<int>& nodesIds, const std::vector<int>& islandsIdxs, int islandsCount)
+		{
+			std::vector<int> positions(islandsCount + 1, 0);
+			for (const int islandIdx : islandsIdxs) {
+				++positions[islandIdx + 1];
+			}
+			for (std::size_t i{ 1 }; i < positions.size(); ++i) {
+				positions[i] += positions[i - 1];
+			}
+
+			TraversalOrder traversalOrder;
+			traversalOrder.nodeOrder.resize(nodesIds.size());
+			NodesColorsIdxs nodesColorsIdxs;
+			for (std::size_t i{ 0 }; i < nodesIds.size(); ++i) {
+				traversalOrder.nodeOrder[positions[islandsIdxs[i]]++] = nodesIds[i];
+				// Every node is inserted at the end of the map
+				nodesColorsIdxs.emplace_hint(nodesColorsIdxs.end(), nodesIds[i], islandsIdxs[i]);
+			}
+
+			return { traversalOrder, nodesColorsIdxs };
+		}
+
+		// Rows of the neighbors with the edges treated as undirected, without loops and repeated neighbors
+		void createUndirectedRows(const GraphSnapshot& graph, std::vector<int>& offsets, std::vector<int>& neighbors)
+		{
+			const auto& outOffsets{ graph.getOffsets() };
+			const auto& outNeighbors{ graph.getNeighbors() };
+			const auto& inOffsets{ graph.getInOffsets() };
+			const auto& inNeighbors{ graph.getInNeighbors() };
+
+			offsets.assign(static_cast<std::size_t>(graph.getNodesCount()) + 1, 0);
+			neighbors.clear();
+			neighbors.reserve(graph.isDirected() ? outNeighbors.size() * 2 : outNeighbors.size());
+			for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+				int i{ outOffsets[node] };
+				int j{ graph.isDirected() ? inOffsets[node] : inOffsets[node + 1] };
+				// Both rows are sorted, so they are merged
+				while (i < outOffsets[node + 1] || j < inOffsets[node + 1]) {
+					int neighbor{ 0 };
+					if (j == inOffsets[node + 1] || (i < outOffsets[node + 1] && outNeighbors[i] < inNeighbors[j])) {
+						neighbor = outNeighbors[i++];
+					}
+					else if (i == outOffsets[node + 1] || inNeighbors[j] < outNeighbors[i]) {
+						neighbor = inNeighbors[j++];
+					}
+					else {
+						neighbor = outNeighbors[i++];
+						++j;
+					}
+
+					if (neighbor != node) {
+						neighbors.push_back(neighbor);
+					}
+				}
+				offsets[node + 1] = static_cast<int>(neighbors.size());
+			}
+		}
+
+		// Weights in the editor are small, Kruskal's algorithm uses counting sort unless the range of the weights is larger than this
+		constexpr long long kruskalCountingSortMaxRange{ 1 << 16 };
+
+		// Returns the path from startNode to endNode found by following the predecessors back from endNode,
+		// empty if endNode was not reached
+		std::vector<int> getPath(const std::vector<int>& predecessors, int startNode, int endNode)
+		{
+			std::vector<int> path;
+			if (endNode != startNode && predecessors[endNode] == -1) {
+				return path;
+			}
+
+			for (int node{ endNode }; node != startNode; node = predecessors[node]) {
+				path.push_back(node);
+			}
+			path.push_back(startNode);
+			std::reverse(path.begin(), path.end());
+			return path;
+		}
+
+		// Path starts with the (startNode, startNode) edge
+		void appendPath(const GraphSnapshot& graph, const std::vector<int>& path, TraversalOrder& traversalOrder)
+		{
+			if (path.empty()) {
+				return;
+			}
+
+			int lastNode{ graph.getNodeId(path.front()) };
+			for (const int nodeIdx : path) {
+				const int node{ graph.getNodeId(nodeIdx) };
+				traversalOrder.nodeOrder.push_back(node);
+				traversalOrder.edgeOrder.push_back({ lastNode, node });
+				lastNode = node;
 			}
-			return visitedNodes;
 		}
 	}
 
 	namespace Impl
 	{
-		void dfsImpl(const Graph& graph, int currentNode, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes, int parentNode = 0)
+		void dfsImpl(const GraphSnapshot& graph, int startNode, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
 		{
-			visitedNodes[currentNode] = true;
-			if (parentNode != 0) {
-				traversalOrder.edgeOrder.push_back({ parentNode, currentNode });
-			}
-			traversalOrder.nodeOrder.push_back(currentNode);
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
 
-			if (const auto it{ graph.getAdjacencyList().find(currentNode) }; it != graph.getAdjacencyList().end()) {
-				for (const int node : it->second) {
-					if (!visitedNodes[node]) {
-						dfsImpl(graph, node, traversalOrder, visitedNodes, currentNode);
-					}
+			// Explicit stack replaces the recursion, so long paths can't overflow the call stack.
+			// pair - node, position of the next neighbor to check in the neighbors array
+			std::vector<std::pair<int, int>> stack;
+			auto visit = [&](int node, int parentNode) {
+				visitedNodes[node] = true;
+				if (parentNode != -1) {
+					traversalOrder.edgeOrder.push_back({ graph.getNodeId(parentNode), graph.getNodeId(node) });
+				}
+				traversalOrder.nodeOrder.push_back(graph.getNodeId(node));
+				stack.push_back({ node, offsets[node] });
+			};
+
+			visit(startNode, -1);
+			while (!stack.empty()) {
+				const int currentNode{ stack.back().first };
+				int& i{ stack.back().second };
+				while (i < offsets[currentNode + 1] && visitedNodes[neighbors[i]]) {
+					++i;
+				}
+
+				if (i == offsets[currentNode + 1]) {
+					stack.pop_back();
+				}
+				else {
+					// Continue from the next neighbor when returning to this node, like the recursive version would
+					visit(neighbors[i++], currentNode);
 				}
 			}
 		}
 
-		void bfsImpl(const Graph& graph, int currentNode, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
+		void bfsImpl(const GraphSnapshot& graph, int currentNode, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
 		{
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+
 			visitedNodes[currentNode] = true;
 			std::queue<int> queue;
 			queue.push(currentNode);
 
 			while (!queue.empty()) {
 				currentNode = queue.front();
-				traversalOrder.nodeOrder.push_back(currentNode);
+				traversalOrder.nodeOrder.push_back(graph.getNodeId(currentNode));
+				queue.pop();
+
+				for (int i{ offsets[currentNode] }; i < offsets[currentNode + 1]; ++i) {
+					const int node{ neighbors[i] };
+					if (!visitedNodes[node]) {
+						traversalOrder.edgeOrder.push_back({ graph.getNodeId(currentNode), graph.getNodeId(node) });
+						visitedNodes[node] = true;
+						queue.push(node);
+					}
+				}
+			}
+		}
+
+		// Direction optimizing BFS (Beamer et al.). Small frontiers are expanded top-down from the frontier nodes, big ones bottom-up,
+		// by checking for every not reached node whether any of its incoming neighbors is in the frontier bitmap.
+		// Both directions give every node the frontier node with the smallest index as its parent, so the result doesn't depend on threads scheduling.
+		// Nodes of each level are emitted in ascending order, which is not the order of the sequential BFS.
+		void parallelBfsImpl(const GraphSnapshot& graph, int startNode, TraversalOrder& traversalOrder)
+		{
+			// Switching thresholds from the paper
+			constexpr long long topDownEdgesFactor{ 14 };
+			constexpr int bottomUpNodesFactor{ 24 };
+
+			const int nodesCount{ graph.getNodesCount() };
+			const int wordsCount{ (nodesCount + 63) / 64 };
+			const int threadsCount{ Parallel::getThreadsCount() };
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+			const auto& inOffsets{ graph.getInOffsets() };
+			const auto& inNeighbors{ graph.getInNeighbors() };
+
+			auto isSet = [](const std::vector<std::uint64_t>& bitmap, int node) {
+				return (bitmap[node / 64] >> (node % 64)) & 1;
+			};
+			auto set = [](std::vector<std::uint64_t>& bitmap, int node) {
+				bitmap[node / 64] |= std::uint64_t{ 1 } << (node % 64);
+			};
+
+			// -1 for nodes which were not reached yet
+			std::vector<std::atomic<int>> parents(nodesCount);
+			for (std::atomic<int>& parent : parents) {
+				parent.store(-1, std::memory_order_relaxed);
+			}
+			// Nodes reached in the previous levels, updated only between the levels
+			std::vector<std::uint64_t> visitedNodes(wordsCount, 0);
+
+			parents[startNode].store(startNode, std::memory_order_relaxed);
+			set(visitedNodes, startNode);
+			traversalOrder.nodeOrder.push_back(graph.getNodeId(startNode));
+
+			std::vector<int> frontier{ startNode };
+			long long unexploredEdgesCount{ static_cast<long long>(neighbors.size()) - graph.getDegree(startNode) };
+			bool bottomUp{ false };
+			std::vector<std::vector<int>> threadsNextFrontiers(threadsCount);
+
+			while (!frontier.empty()) {
+				long long frontierEdgesCount{ 0 };
+				for (const int node : frontier) {
+					frontierEdgesCount += graph.getDegree(node);
+				}
+				if (!bottomUp && frontierEdgesCount > unexploredEdgesCount / topDownEdgesFactor) {
+					bottomUp = true;
+				}
+				else if (bottomUp && static_cast<int>(frontier.size()) < nodesCount / bottomUpNodesFactor) {
+					bottomUp = false;
+				}
+
+				std::vector<int> nextFrontier;
+				if (bottomUp) {
+					std::vector<std::uint64_t> frontierBitmap(wordsCount, 0);
+					for (const int node : frontier) {
+						set(frontierBitmap, node);
+					}
+
+					// Chunks are made of whole words, so every thread writes only its own words of the next frontier bitmap
+					std::vector<std::uint64_t> nextFrontierBitmap(wordsCount, 0);
+					Parallel::parallelFor(0, wordsCount, [&](int wordsBegin, int wordsEnd, int) {
+						for (int node{ wordsBegin * 64 }; node < std::min(nodesCount, wordsEnd * 64); ++node) {
+							if (isSet(visitedNodes, node)) {
+								continue;
+							}
+							// Incoming rows are sorted, so the first neighbor found in the frontier is the smallest one
+							for (int i{ inOffsets[node] }; i < inOffsets[node + 1]; ++i) {
+								if (isSet(frontierBitmap, inNeighbors[i])) {
+									parents[node].store(inNeighbors[i], std::memory_order_relaxed);
+									set(nextFrontierBitmap, node);
+									break;
+								}
+							}
+						}
+						}, threadsCount);
+
+					for (int node{ 0 }; node < nodesCount; ++node) {
+						if (isSet(nextFrontierBitmap, node)) {
+							nextFrontier.push_back(node);
+						}
+					}
+				}
+				else {
+					for (std::vector<int>& threadNextFrontier : threadsNextFrontiers) {
+						threadNextFrontier.clear();
+					}
+
+					Parallel::parallelFor(0, static_cast<int>(frontier.size()), [&](int frontierBegin, int frontierEnd, int threadIdx) {
+						for (int j{ frontierBegin }; j < frontierEnd; ++j) {
+							const int currentNode{ frontier[j] };
+							for (int i{ offsets[currentNode] }; i < offsets[currentNode + 1]; ++i) {
+								const int node{ neighbors[i] };
+								if (isSet(visitedNodes, node)) {
+									continue;
+								}
+
+								// Keep the smallest parent, the thread which reached the node first adds it to the next frontier
+								int parent{ parents[node].load(std::memory_order_relaxed) };
+								while (parent == -1 || currentNode < parent) {
+									if (parents[node].compare_exchange_weak(parent, currentNode, std::memory_order_relaxed)) {
+										if (parent == -1) {
+											threadsNextFrontiers[threadIdx].push_back(node);
+										}
+										break;
+									}
+								}
+							}
+						}
+						}, threadsCount);
+
+					for (const std::vector<int>& threadNextFrontier : threadsNextFrontiers) {
+						nextFrontier.insert(nextFrontier.end(), threadNextFrontier.begin(), threadNextFrontier.end());
+					}
+					std::sort(nextFrontier.begin(), nextFrontier.end());
+				}
+
+				for (const int node : nextFrontier) {
+					set(visitedNodes, node);
+					unexploredEdgesCount -= graph.getDegree(node);
+					traversalOrder.nodeOrder.push_back(graph.getNodeId(node));
+					traversalOrder.edgeOrder.push_back({ graph.getNodeId(parents[node].load(std::memory_order_relaxed)), graph.getNodeId(node) });
+				}
+				frontier = std::move(nextFrontier);
+			}
+		}
+
+		// Fills the distances and predecessors until the end node is popped from the queue, or for all the nodes if endNode is -1.
+		// Distances have to be filled with std::numeric_limits<int>::max(). Returns the number of expanded nodes.
+		int binaryHeapSearch(const GraphSnapshot& graph, int startNode, int endNode, std::vector<int>& distances, std::vector<int>& predecessors)
+		{
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+			const auto& weights{ graph.getWeights() };
+
+			// pair - distance, node
+			std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> queue;
+			queue.push({ 0, startNode });
+			distances[startNode] = 0;
+			int expandedNodesCount{ 0 };
+
+			while (!queue.empty()) {
+				const auto [currentDistance, currentNode] { queue.top() };
 				queue.pop();
 
-				if (const auto it{ graph.getAdjacencyList().find(currentNode) }; it != graph.getAdjacencyList().end()) {
-					for (const int node : it->second) {
-						if (!visitedNodes[node]) {
-							traversalOrder.edgeOrder.push_back({ currentNode, node });
-							visitedNodes[node] = true;
-							queue.push(node);
-						}
+				// Node was already popped with a shorter distance, the entry is stale
+				if (currentDistance > distances[currentNode]) {
+					continue;
+				}
+				// Distance of a popped node is final
+				if (currentNode == endNode) {
+					break;
+				}
+
+				++expandedNodesCount;
+				for (int i{ offsets[currentNode] }; i < offsets[currentNode + 1]; ++i) {
+					const int node{ neighbors[i] };
+					const int distance{ currentDistance + weights[i] };
+					if (distance < distances[node]) {
+						distances[node] = distance;
+						predecessors[node] = currentNode;
+						queue.push({ distance, node });
+					}
+				}
+			}
+			return expandedNodesCount;
+		}
+
+		// Dial's algorithm, same as binaryHeapSearch, but the nodes are kept in buckets indexed by their distance.
+		// Weights have to be non-negative.
+		int bucketQueueSearch(const GraphSnapshot& graph, int startNode, int endNode, std::vector<int>& distances, std::vector<int>& predecessors)
+		{
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+			const auto& weights{ graph.getWeights() };
+
+			// Queued distances are always in range [currentDistance, currentDistance + maxWeight], so the buckets can be reused cyclically
+			std::vector<std::vector<int>> buckets(static_cast<std::size_t>(graph.getMaxWeight()) + 1);
+			buckets[0].push_back(startNode);
+			distances[startNode] = 0;
+			int queuedCount{ 1 };
+			int expandedNodesCount{ 0 };
+
+			for (int currentDistance{ 0 }; queuedCount > 0; ++currentDistance) {
+				// Nodes with the same distance are popped in ascending order, as from the binary heap.
+				// The bucket is a heap itself, because edges with 0 weight add nodes to the bucket being popped.
+				std::vector<int>& bucket{ buckets[currentDistance % buckets.size()] };
+				while (!bucket.empty()) {
+					std::pop_heap(bucket.begin(), bucket.end(), std::greater<int>{});
+					const int currentNode{ bucket.back() };
+					bucket.pop_back();
+					--queuedCount;
+
+					// Node was already popped with a shorter distance, the entry is stale
+					if (distances[currentNode] != currentDistance) {
+						continue;
+					}
+					if (currentNode == endNode) {
+						return expandedNodesCount;
+					}
+
+					++expandedNodesCount;
+					for (int i{ offsets[currentNode] }; i < offsets[currentNode + 1]; ++i) {
+						const int node{ neighbors[i] };
+						const int distance{ currentDistance + weights[i] };
+						if (distance < distances[node]) {
+							distances[node] = distance;
+							predecessors[node] = currentNode;
+							std::vector<int>& nodeBucket{ buckets[distance % buckets.size()] };
+							nodeBucket.push_back(node);
+							std::push_heap(nodeBucket.begin(), nodeBucket.end(), std::greater<int>{});
+							++queuedCount;
+						}
+					}
+				}
+			}
+			return expandedNodesCount;
+		}
+
+		// Kernels are instantiated for each directed/weighted mode of the graph, so the mode is not checked for every edge
+		template<Weighted weighted>
+		void dijkstraImpl(const GraphSnapshot& graph, int startNode, int endNode, ShortestPathQueue queue, TraversalOrder& traversalOrder, int& expandedNodesCount)
+		{
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+
+			// Previous node on the shortest path found so far, -1 for the start node and not reached nodes
+			std::vector<int> predecessors(graph.getNodesCount(), -1);
+
+			if constexpr (weighted == Weighted::Yes) {
+				std::vector<int> distances(graph.getNodesCount(), std::numeric_limits<int>::max());
+				if (Helpers::useBucketQueue(graph, queue)) {
+					expandedNodesCount = bucketQueueSearch(graph, startNode, endNode, distances, predecessors);
+				}
+				else {
+					expandedNodesCount = binaryHeapSearch(graph, startNode, endNode, distances, predecessors);
+				}
+			}
+			else {
+				// All the edges have the same weight, so nodes are reached for the first time on their shortest path.
+				// Levels are visited in ascending node order, the same order in which the priority queue would pop them.
+				std::vector<bool> reachedNodes(graph.getNodesCount(), false);
+				std::vector<int> currentLevel{ startNode };
+				std::vector<int> nextLevel;
+				reachedNodes[startNode] = true;
+
+				while (!currentLevel.empty() && !reachedNodes[endNode]) {
+					expandedNodesCount += static_cast<int>(currentLevel.size());
+					for (const int currentNode : currentLevel) {
+						for (int i{ offsets[currentNode] }; i < offsets[currentNode + 1]; ++i) {
+							const int node{ neighbors[i] };
+							if (!reachedNodes[node]) {
+								reachedNodes[node] = true;
+								predecessors[node] = currentNode;
+								nextLevel.push_back(node);
+							}
+						}
+					}
+
+					std::sort(nextLevel.begin(), nextLevel.end());
+					currentLevel.swap(nextLevel);
+					nextLevel.clear();
+				}
+			}
+
+			Helpers::appendPath(graph, Helpers::getPath(predecessors, startNode, endNode), traversalOrder);
+		}
+
+		// Returns the number of expanded nodes
+		int aStarImpl(const GraphSnapshot& graph, int startNode, int endNode, const PositionLookup& getPosition, TraversalOrder& traversalOrder)
+		{
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+			const auto& weights{ graph.getWeights() };
+
+			std::vector<std::pair<float, float>> positions(graph.getNodesCount());
+			for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+				positions[node] = getPosition(graph.getNodeId(node));
+			}
+			auto getDistance = [&positions](int a, int b) {
+				return std::hypot(static_cast<double>(positions[a].first) - positions[b].first, static_cast<double>(positions[a].second) - positions[b].second);
+			};
+
+			// Heuristic is the straight line distance to the end node scaled by the smallest weight per unit of length of all the edges,
+			// so it never overestimates the remaining distance (and stays consistent) whatever the positions are
+			double scale{ std::numeric_limits<double>::max() };
+			for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+				for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+					const double length{ getDistance(node, neighbors[i]) };
+					if (length > 0.0) {
+						scale = std::min(scale, weights[i] / length);
+					}
+				}
+			}
+			scale = std::max(scale == std::numeric_limits<double>::max() ? 0.0 : scale, 0.0);
+
+			std::vector<int> distances(graph.getNodesCount(), std::numeric_limits<int>::max());
+			std::vector<int> predecessors(graph.getNodesCount(), -1);
+			// tuple - estimated length of the whole path, distance, node
+			using Entry = std::tuple<double, int, int>;
+			std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+			queue.push({ scale * getDistance(startNode, endNode), 0, startNode });
+			distances[startNode] = 0;
+			int expandedNodesCount{ 0 };
+
+			while (!queue.empty()) {
+				const auto [estimatedLength, currentDistance, currentNode] { queue.top() };
+				queue.pop();
+
+				// Node was already popped with a shorter distance, the entry is stale
+				if (currentDistance > distances[currentNode]) {
+					continue;
+				}
+				if (currentNode == endNode) {
+					break;
+				}
+
+				++expandedNodesCount;
+				for (int i{ offsets[currentNode] }; i < offsets[currentNode + 1]; ++i) {
+					const int node{ neighbors[i] };
+					const int distance{ currentDistance + weights[i] };
+					if (distance < distances[node]) {
+						distances[node] = distance;
+						predecessors[node] = currentNode;
+						queue.push({ distance + scale * getDistance(node, endNode), distance, node });
+					}
+				}
+			}
+
+			Helpers::appendPath(graph, Helpers::getPath(predecessors, startNode, endNode), traversalOrder);
+			return expandedNodesCount;
+		}
+
+		void bidirectionalDijkstraImpl(const GraphSnapshot& graph, int startNode, int endNode, TraversalOrder& traversalOrder)
+		{
+			// Forward search from the start node follows outgoing edges, backward search from the end node follows incoming ones.
+			// In undirected graph both use the same rows.
+			const std::vector<int>* offsets[2]{ &graph.getOffsets(), &graph.getInOffsets() };
+			const std::vector<int>* neighbors[2]{ &graph.getNeighbors(), &graph.getInNeighbors() };
+			const std::vector<int>* weights[2]{ &graph.getWeights(), &graph.getInWeights() };
+
+			constexpr int infinity{ std::numeric_limits<int>::max() };
+			std::vector<int> distances[2]{ std::vector<int>(graph.getNodesCount(), infinity), std::vector<int>(graph.getNodesCount(), infinity) };
+			// Previous node on the path from the start node / next node on the path to the end node
+			std::vector<int> parents[2]{ std::vector<int>(graph.getNodesCount(), -1), std::vector<int>(graph.getNodesCount(), -1) };
+			// pair - distance, node
+			std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> queues[2];
+
+			distances[0][startNode] = 0;
+			distances[1][endNode] = 0;
+			queues[0].push({ 0, startNode });
+			queues[1].push({ 0, endNode });
+
+			// Length of the shortest path found so far and the node where its two halves meet
+			int shortestDistance{ startNode == endNode ? 0 : infinity };
+			int meetingNode{ startNode == endNode ? startNode : -1 };
+
+			while (!queues[0].empty() && !queues[1].empty()) {
+				// None of the not yet popped nodes can be on a shorter path
+				const long long lowerBound{ static_cast<long long>(queues[0].top().first) + queues[1].top().first };
+				if (lowerBound >= shortestDistance) {
+					break;
+				}
+
+				const int side{ queues[0].top().first <= queues[1].top().first ? 0 : 1 };
+				const int otherSide{ 1 - side };
+				const auto [currentDistance, currentNode] { queues[side].top() };
+				queues[side].pop();
+
+				// Node was already popped with a shorter distance, the entry is stale
+				if (currentDistance > distances[side][currentNode]) {
+					continue;
+				}
+
+				for (int i{ (*offsets[side])[currentNode] }; i < (*offsets[side])[currentNode + 1]; ++i) {
+					const int node{ (*neighbors[side])[i] };
+					const int distance{ currentDistance + (*weights[side])[i] };
+					if (distance < distances[side][node]) {
+						distances[side][node] = distance;
+						parents[side][node] = currentNode;
+						queues[side].push({ distance, node });
+					}
+
+					if (distances[otherSide][node] != infinity && distances[side][node] + distances[otherSide][node] < shortestDistance) {
+						shortestDistance = distances[side][node] + distances[otherSide][node];
+						meetingNode = node;
+					}
+				}
+			}
+
+			if (meetingNode == -1) {
+				return;
+			}
+
+			std::vector<int> path{ Helpers::getPath(parents[0], startNode, meetingNode) };
+			for (int node{ meetingNode }; node != endNode; ) {
+				node = parents[1][node];
+				path.push_back(node);
+			}
+			Helpers::appendPath(graph, path, traversalOrder);
+		}
+
+		void deltaSteppingImpl(const GraphSnapshot& graph, int startNode, int delta, ShortestPaths& shortestPaths)
+		{
+			const int nodesCount{ graph.getNodesCount() };
+			const int threadsCount{ Parallel::getThreadsCount() };
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+			const auto& weights{ graph.getWeights() };
+
+			constexpr int unreached{ std::numeric_limits<int>::max() };
+			std::vector<std::atomic<int>> distances(nodesCount);
+			for (std::atomic<int>& distance : distances) {
+				distance.store(unreached, std::memory_order_relaxed);
+			}
+			distances[startNode].store(0, std::memory_order_relaxed);
+			auto getDistance = [&distances](int node) { return distances[node].load(std::memory_order_relaxed); };
+
+			// Queued distances are always in range [currentBucket * delta, currentBucket * delta + delta + maxWeight),
+			// so the buckets can be reused cyclically
+			std::vector<std::vector<int>> buckets(static_cast<std::size_t>(graph.getMaxWeight()) / delta + 2);
+			auto getBucket = [&buckets, delta](int distance) -> std::vector<int>& { return buckets[(distance / delta) % buckets.size()]; };
+			buckets[0].push_back(startNode);
+			long long queuedCount{ 1 };
+
+			// Nodes whose distance was decreased by each thread
+			std::vector<std::vector<int>> threadsUpdatedNodes(threadsCount);
+			// Round of relaxations in which the distance of the node was set. Nodes are relaxed with their distances from before the round,
+			// so the node which set the final distance of a node has its own final distance from an earlier round, even on zero weight edges.
+			std::vector<int> setRounds(nodesCount, -1);
+			int round{ 0 };
+			std::vector<int> nodesDistances;
+
+			// Relaxes light (weight <= delta) or heavy edges of the given nodes in parallel and queues the nodes with decreased distance
+			auto relaxEdges = [&](const std::vector<int>& nodes, bool light) {
+				nodesDistances.resize(nodes.size());
+				std::transform(nodes.begin(), nodes.end(), nodesDistances.begin(), getDistance);
+				Parallel::parallelFor(0, static_cast<int>(nodes.size()), [&](int nodesBegin, int nodesEnd, int threadIdx) {
+					for (int j{ nodesBegin }; j < nodesEnd; ++j) {
+						const int currentNode{ nodes[j] };
+						for (int i{ offsets[currentNode] }; i < offsets[currentNode + 1]; ++i) {
+							const int node{ neighbors[i] };
+							if ((weights[i] <= delta) != light || node == startNode) {
+								continue;
+							}
+
+							const int newDistance{ nodesDistances[j] + weights[i] };
+							int distance{ getDistance(node) };
+							while (newDistance < distance) {
+								if (distances[node].compare_exchange_weak(distance, newDistance, std::memory_order_relaxed)) {
+									threadsUpdatedNodes[threadIdx].push_back(node);
+									break;
+								}
+							}
+						}
+					}
+					}, threadsCount);
+
+				for (std::vector<int>& threadUpdatedNodes : threadsUpdatedNodes) {
+					for (const int node : threadUpdatedNodes) {
+						getBucket(getDistance(node)).push_back(node);
+						setRounds[node] = round;
+					}
+					queuedCount += threadUpdatedNodes.size();
+					threadUpdatedNodes.clear();
+				}
+				++round;
+			};
+
+			std::vector<int> frontier;
+			std::vector<int> settledNodes;
+			for (int currentBucket{ 0 }; queuedCount > 0; ++currentBucket) {
+				std::vector<int>& bucket{ buckets[currentBucket % buckets.size()] };
+				settledNodes.clear();
+
+				// Light edges can add nodes back to the current bucket, so it is processed until it stays empty
+				while (!bucket.empty()) {
+					frontier.clear();
+					frontier.swap(bucket);
+					queuedCount -= frontier.size();
+
+					// Skip duplicates and nodes whose distance was decreased below this bucket in the meantime
+					std::sort(frontier.begin(), frontier.end());
+					frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+					frontier.erase(std::remove_if(frontier.begin(), frontier.end(), [&](int node) {
+						return getDistance(node) / delta != currentBucket;
+						}), frontier.end());
+
+					relaxEdges(frontier, true);
+					settledNodes.insert(settledNodes.end(), frontier.begin(), frontier.end());
+				}
+
+				// Distances of the nodes of this bucket are final now, heavy edges can't lead back into it
+				std::sort(settledNodes.begin(), settledNodes.end());
+				settledNodes.erase(std::unique(settledNodes.begin(), settledNodes.end()), settledNodes.end());
+				relaxEdges(settledNodes, false);
+			}
+
+			// Predecessors are chosen once the distances are final, the smallest index one whose distance was set in an earlier round
+			const auto& inOffsets{ graph.getInOffsets() };
+			const auto& inNeighbors{ graph.getInNeighbors() };
+			const auto& inWeights{ graph.getInWeights() };
+			shortestPaths.distances.resize(nodesCount);
+			shortestPaths.predecessors.assign(nodesCount, -1);
+			Parallel::parallelFor(0, nodesCount, [&](int nodesBegin, int nodesEnd, int) {
+				for (int node{ nodesBegin }; node < nodesEnd; ++node) {
+					const int distance{ getDistance(node) };
+					shortestPaths.distances[node] = distance;
+					if (distance == unreached || node == startNode) {
+						continue;
+					}
+					for (int i{ inOffsets[node] }; i < inOffsets[node + 1]; ++i) {
+						const int predecessor{ inNeighbors[i] };
+						if (setRounds[predecessor] < setRounds[node] && getDistance(predecessor) != unreached
+							&& getDistance(predecessor) + inWeights[i] == distance
+							&& (shortestPaths.predecessors[node] == -1 || predecessor < shortestPaths.predecessors[node])) {
+							shortestPaths.predecessors[node] = predecessor;
+						}
+					}
+				}
+				}, threadsCount);
+		}
+
+		// Floyd-Warshall runs on 32-bit distances if no path can reach this value, they are twice as fast as 64-bit ones
+		template<typename Distance>
+		constexpr Distance unreachableDistance()
+		{
+			if constexpr (std::is_same_v<Distance, int>) {
+				return DistanceMatrix::intUnreachable;
+			}
+			else {
+				return DistanceMatrix::unreachable;
+			}
+		}
+
+		// min(c, a + b) for a single distance. Without negative weights no sum gets below an unreachable distance, otherwise
+		// sums through unreachable distances are skipped and clamped from below, so going around a negative cycle can't overflow.
+		template<typename Distance, bool negativeWeights>
+		Distance minPlus(Distance c, Distance a, Distance b)
+		{
+			constexpr Distance unreachable{ unreachableDistance<Distance>() };
+			if constexpr (negativeWeights) {
+				return b == unreachable ? c : std::min(c, std::max(a + b, -unreachable));
+			}
+			else {
+				return std::min(c, a + b);
+			}
+		}
+
+#if defined(__AVX2__)
+		// minPlus for a vector of distances, AVX2 has no 64-bit min and max, so they are comparisons and blends
+		template<typename Distance, bool negativeWeights>
+		__m256i minPlusVector(__m256i c, __m256i a, __m256i b)
+		{
+			if constexpr (std::is_same_v<Distance, int>) {
+				static_assert(!negativeWeights, "32-bit distances are used only for non-negative weights");
+				return _mm256_min_epi32(c, _mm256_add_epi32(a, b));
+			}
+			else {
+				__m256i sum{ _mm256_add_epi64(a, b) };
+				__m256i isSmaller{ _mm256_cmpgt_epi64(c, sum) };
+				if constexpr (negativeWeights) {
+					const __m256i unreachable{ _mm256_set1_epi64x(DistanceMatrix::unreachable) };
+					const __m256i negativeUnreachable{ _mm256_set1_epi64x(-DistanceMatrix::unreachable) };
+					sum = _mm256_blendv_epi8(sum, negativeUnreachable, _mm256_cmpgt_epi64(negativeUnreachable, sum));
+					isSmaller = _mm256_andnot_si256(_mm256_cmpeq_epi64(b, unreachable), _mm256_cmpgt_epi64(c, sum));
+				}
+				return _mm256_blendv_epi8(c, sum, isSmaller);
+			}
+		}
+
+		template<typename Distance>
+		__m256i broadcast(Distance distance)
+		{
+			if constexpr (std::is_same_v<Distance, int>) {
+				return _mm256_set1_epi32(distance);
+			}
+			else {
+				return _mm256_set1_epi64x(distance);
+			}
+		}
+#endif
+
+		// Floyd-Warshall step for the tiles of the distance matrix: c[i][j] = min(c[i][j], a[i][k] + b[k][j]).
+		// Tiles can be the same tile, k is the outer loop so the result is correct then as well.
+		template<typename Distance, bool negativeWeights>
+		void minPlusTile(Distance* c, const Distance* a, const Distance* b, int stride)
+		{
+			constexpr int tileSize{ DistanceMatrix::tileSize };
+			for (int k{ 0 }; k < tileSize; ++k) {
+				const Distance* bRow{ b + static_cast<std::size_t>(k) * stride };
+				for (int i{ 0 }; i < tileSize; ++i) {
+					const Distance aik{ a[static_cast<std::size_t>(i) * stride + k] };
+					if (aik == unreachableDistance<Distance>()) {
+						continue;
+					}
+					Distance* cRow{ c + static_cast<std::size_t>(i) * stride };
+#if defined(__AVX2__)
+					constexpr int vectorSize{ sizeof(__m256i) / sizeof(Distance) };
+					const __m256i aikVector{ broadcast(aik) };
+					for (int j{ 0 }; j < tileSize; j += vectorSize) {
+						const __m256i current{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cRow + j)) };
+						const __m256i bVector{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bRow + j)) };
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(cRow + j), minPlusVector<Distance, negativeWeights>(current, aikVector, bVector));
+					}
+#else
+					for (int j{ 0 }; j < tileSize; ++j) {
+						cRow[j] = minPlus<Distance, negativeWeights>(cRow[j], aik, bRow[j]);
+					}
+#endif
+				}
+			}
+		}
+
+		// Same as minPlusTile for a tile c different from a and b, a row of c is kept in registers while going through all k
+		template<typename Distance, bool negativeWeights>
+		void minPlusIndependentTile(Distance* c, const Distance* a, const Distance* b, int stride)
+		{
+			constexpr int tileSize{ DistanceMatrix::tileSize };
+			for (int i{ 0 }; i < tileSize; ++i) {
+				const Distance* aRow{ a + static_cast<std::size_t>(i) * stride };
+				Distance* cRow{ c + static_cast<std::size_t>(i) * stride };
+#if defined(__AVX2__)
+				constexpr int vectorSize{ sizeof(__m256i) / sizeof(Distance) };
+				constexpr int vectorsCount{ tileSize / vectorSize };
+				__m256i cVectors[vectorsCount];
+				for (int v{ 0 }; v < vectorsCount; ++v) {
+					cVectors[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cRow + v * vectorSize));
+				}
+				for (int k{ 0 }; k < tileSize; ++k) {
+					if (aRow[k] == unreachableDistance<Distance>()) {
+						continue;
+					}
+					const __m256i aikVector{ broadcast(aRow[k]) };
+					const Distance* bRow{ b + static_cast<std::size_t>(k) * stride };
+					for (int v{ 0 }; v < vectorsCount; ++v) {
+						const __m256i bVector{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bRow + v * vectorSize)) };
+						cVectors[v] = minPlusVector<Distance, negativeWeights>(cVectors[v], aikVector, bVector);
+					}
+				}
+				for (int v{ 0 }; v < vectorsCount; ++v) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(cRow + v * vectorSize), cVectors[v]);
+				}
+#else
+				for (int k{ 0 }; k < tileSize; ++k) {
+					if (aRow[k] == unreachableDistance<Distance>()) {
+						continue;
+					}
+					const Distance* bRow{ b + static_cast<std::size_t>(k) * stride };
+					for (int j{ 0 }; j < tileSize; ++j) {
+						cRow[j] = minPlus<Distance, negativeWeights>(cRow[j], aRow[k], bRow[j]);
+					}
+				}
+#endif
+			}
+		}
+
+		// Blocked Floyd-Warshall, for every diagonal tile it's processed first, then the tiles in its row and column, then all the other tiles.
+		// Tiles of the last two phases don't depend on each other, so they are processed in parallel.
+		template<typename Distance, bool negativeWeights>
+		void floydWarshallImpl(std::vector<Distance>& matrix, int stride, ExecutionPolicy executionPolicy)
+		{
+			constexpr int tileSize{ DistanceMatrix::tileSize };
+			const int tilesCount{ stride / tileSize };
+			const int threadsCount{ executionPolicy == ExecutionPolicy::Parallel ? Parallel::getThreadsCount() : 1 };
+			auto getTile = [&matrix, stride](int tileRow, int tileColumn) {
+				return matrix.data() + static_cast<std::size_t>(tileRow) * tileSize * stride + static_cast<std::size_t>(tileColumn) * tileSize;
+			};
+
+			for (int k{ 0 }; k < tilesCount; ++k) {
+				Distance* diagonalTile{ getTile(k, k) };
+				minPlusTile<Distance, negativeWeights>(diagonalTile, diagonalTile, diagonalTile, stride);
+
+				// [0, tilesCount) are the tiles of row k, [tilesCount, 2 * tilesCount) the tiles of column k
+				Parallel::parallelFor(0, 2 * tilesCount, [&](int tilesBegin, int tilesEnd, int) {
+					for (int tile{ tilesBegin }; tile < tilesEnd; ++tile) {
+						if (tile < tilesCount && tile != k) {
+							minPlusTile<Distance, negativeWeights>(getTile(k, tile), diagonalTile, getTile(k, tile), stride);
+						}
+						else if (tile >= tilesCount && tile - tilesCount != k) {
+							minPlusTile<Distance, negativeWeights>(getTile(tile - tilesCount, k), getTile(tile - tilesCount, k), diagonalTile, stride);
+						}
+					}
+					}, threadsCount, 1);
+
+				Parallel::parallelFor(0, tilesCount, [&](int tileRowsBegin, int tileRowsEnd, int) {
+					for (int i{ tileRowsBegin }; i < tileRowsEnd; ++i) {
+						if (i == k) {
+							continue;
+						}
+						for (int j{ 0 }; j < tilesCount; ++j) {
+							if (j != k) {
+								minPlusIndependentTile<Distance, negativeWeights>(getTile(i, j), getTile(i, k), getTile(k, j), stride);
+							}
+						}
+					}
+					}, threadsCount, 1);
+			}
+		}
+
+		// Runs Floyd-Warshall on the edges of the graph, rows of the returned matrix are padded to whole tiles.
+		// Padding rows and columns stay unreachable so they don't change the distances.
+		template<typename Distance, bool negativeWeights>
+		std::vector<Distance> floydWarshall(const GraphSnapshot& graph, int stride, ExecutionPolicy executionPolicy)
+		{
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+			const auto& weights{ graph.getWeights() };
+
+			std::vector<Distance> matrix(static_cast<std::size_t>(stride) * stride, unreachableDistance<Distance>());
+			for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+				Distance* row{ matrix.data() + static_cast<std::size_t>(node) * stride };
+				row[node] = 0;
+				for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+					row[neighbors[i]] = std::min(row[neighbors[i]], static_cast<Distance>(weights[i]));
+				}
+			}
+
+			floydWarshallImpl<Distance, negativeWeights>(matrix, stride, executionPolicy);
+			return matrix;
+		}
+
+		// Colors the nodes in the given order, every node gets the smallest color not used by its colored neighbors.
+		// Colors of the neighbors are marked with the stamp of the current node, so the marks never have to be cleared.
+		// Returns the number of used colors.
+		int greedyColoringImpl(const std::vector<int>& offsets, const std::vector<int>& neighbors, const std::vector<int>& order, std::vector<int>& colors)
+		{
+			const int nodesCount{ static_cast<int>(offsets.size()) - 1 };
+			colors.assign(nodesCount, -1);
+			// Node never needs a color bigger than its degree
+			std::vector<int> forbiddenStamps(nodesCount + 1, -1);
+
+			int colorsCount{ 0 };
+			for (const int node : order) {
+				for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+					if (colors[neighbors[i]] != -1) {
+						forbiddenStamps[colors[neighbors[i]]] = node;
+					}
+				}
+
+				int color{ 0 };
+				while (forbiddenStamps[color] == node) {
+					++color;
+				}
+				colors[node] = color;
+				colorsCount = std::max(colorsCount, color + 1);
+			}
+			return colorsCount;
+		}
+
+		// Nodes with the smallest degree are removed one by one, with the degrees kept in buckets (Matula & Beck).
+		// Coloring them in the reverse order uses at most degeneracy + 1 colors.
+		std::vector<int> smallestLastOrder(const std::vector<int>& offsets, const std::vector<int>& neighbors)
+		{
+			const int nodesCount{ static_cast<int>(offsets.size()) - 1 };
+			std::vector<int> degrees(nodesCount);
+			int maxDegree{ 0 };
+			for (int node{ 0 }; node < nodesCount; ++node) {
+				degrees[node] = offsets[node + 1] - offsets[node];
+				maxDegree = std::max(maxDegree, degrees[node]);
+			}
+
+			// Nodes sorted by their current degree, bucketsBegins[degree] is the position of the first node with that degree
+			std::vector<int> bucketsBegins(static_cast<std::size_t>(maxDegree) + 2, 0);
+			for (const int degree : degrees) {
+				++bucketsBegins[degree + 1];
+			}
+			for (std::size_t i{ 1 }; i < bucketsBegins.size(); ++i) {
+				bucketsBegins[i] += bucketsBegins[i - 1];
+			}
+			std::vector<int> order(nodesCount);
+			std::vector<int> positions(nodesCount);
+			{
+				std::vector<int> nextPositions{ bucketsBegins };
+				for (int node{ 0 }; node < nodesCount; ++node) {
+					positions[node] = nextPositions[degrees[node]]++;
+					order[positions[node]] = node;
+				}
+			}
+
+			for (int i{ 0 }; i < nodesCount; ++i) {
+				const int node{ order[i] };
+				for (int j{ offsets[node] }; j < offsets[node + 1]; ++j) {
+					const int neighbor{ neighbors[j] };
+					if (degrees[neighbor] <= degrees[node]) {
+						continue;
+					}
+
+					// Move the neighbor to the front of its bucket, then the bucket starts one position later
+					const int degree{ degrees[neighbor] };
+					const int firstPosition{ bucketsBegins[degree] };
+					const int firstNode{ order[firstPosition] };
+					if (firstNode != neighbor) {
+						std::swap(order[positions[neighbor]], order[firstPosition]);
+						std::swap(positions[neighbor], positions[firstNode]);
+					}
+					++bucketsBegins[degree];
+					--degrees[neighbor];
+				}
+			}
+
+			std::reverse(order.begin(), order.end());
+			return order;
+		}
+
+		// Colors the node with the most distinct colors among its neighbors (saturation) next. Nodes are kept in buckets by saturation,
+		// outdated entries are skipped when popped. Ties are broken by the degree at the start, later the last updated node goes first.
+		// Returns the number of used colors.
+		int dsaturColoringImpl(const std::vector<int>& offsets, const std::vector<int>& neighbors, std::vector<int>& order, std::vector<int>& colors)
+		{
+			const int nodesCount{ static_cast<int>(offsets.size()) - 1 };
+			colors.assign(nodesCount, -1);
+			order.clear();
+			order.reserve(nodesCount);
+
+			std::vector<int> saturations(nodesCount, 0);
+			// Colors of the neighbors of every node, one bit per color
+			std::vector<std::vector<std::uint64_t>> neighborsColors(nodesCount);
+			std::vector<int> forbiddenStamps(nodesCount + 1, -1);
+
+			int maxDegree{ 0 };
+			for (int node{ 0 }; node < nodesCount; ++node) {
+				maxDegree = std::max(maxDegree, offsets[node + 1] - offsets[node]);
+			}
+			// Saturation is never bigger than the degree
+			std::vector<std::vector<int>> buckets(static_cast<std::size_t>(maxDegree) + 1);
+			{
+				// Nodes with the biggest degree are on the top of the first bucket, the smaller index first
+				std::vector<int> degreesBegins(static_cast<std::size_t>(maxDegree) + 2, 0);
+				for (int node{ 0 }; node < nodesCount; ++node) {
+					++degreesBegins[offsets[node + 1] - offsets[node] + 1];
+				}
+				for (std::size_t i{ 1 }; i < degreesBegins.size(); ++i) {
+					degreesBegins[i] += degreesBegins[i - 1];
+				}
+				buckets[0].resize(nodesCount);
+				for (int node{ nodesCount - 1 }; node >= 0; --node) {
+					buckets[0][degreesBegins[offsets[node + 1] - offsets[node]]++] = node;
+				}
+			}
+
+			int colorsCount{ 0 };
+			int maxSaturation{ 0 };
+			while (static_cast<int>(order.size()) < nodesCount) {
+				while (buckets[maxSaturation].empty()) {
+					--maxSaturation;
+				}
+				const int node{ buckets[maxSaturation].back() };
+				buckets[maxSaturation].pop_back();
+				if (colors[node] != -1 || saturations[node] != maxSaturation) {
+					continue;
+				}
+
+				for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+					if (colors[neighbors[i]] != -1) {
+						forbiddenStamps[colors[neighbors[i]]] = node;
+					}
+				}
+				int color{ 0 };
+				while (forbiddenStamps[color] == node) {
+					++color;
+				}
+				colors[node] = color;
+				colorsCount = std::max(colorsCount, color + 1);
+				order.push_back(node);
+
+				const std::size_t word{ static_cast<std::size_t>(color) / 64 };
+				const std::uint64_t bit{ std::uint64_t{ 1 } << (color % 64) };
+				for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+					const int neighbor{ neighbors[i] };
+					if (colors[neighbor] != -1) {
+						continue;
+					}
+
+					std::vector<std::uint64_t>& neighborColors{ neighborsColors[neighbor] };
+					if (neighborColors.size() <= word) {
+						neighborColors.resize(word + 1, 0);
+					}
+					if (!(neighborColors[word] & bit)) {
+						neighborColors[word] |= bit;
+						const int saturation{ ++saturations[neighbor] };
+						buckets[saturation].push_back(neighbor);
+						maxSaturation = std::max(maxSaturation, saturation);
 					}
 				}
 			}
+			return colorsCount;
 		}
 
-		void dijkstraImpl(const Graph& graph, int startNode, int endNode, TraversalOrder& traversalOrder)
+		// Jones-Plassmann: every node gets a random priority and is colored once all its neighbors with higher priorities are colored,
+		// with the smallest color not used by them. Nodes colored in the same round are never adjacent, so every round runs in parallel.
+		// The result is the same as from coloring the nodes greedily in the order of their priorities, regardless of the threads count.
+		int jonesPlassmannColoringImpl(const std::vector<int>& offsets, const std::vector<int>& neighbors, std::vector<int>& order, std::vector<int>& colors)
 		{
-			std::map<int, std::optional<int>> distances;
-			std::map<int, std::vector<int>> paths;
-			// pair - distance, node
-			std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> queue;
-			queue.push({ 0, startNode });
-			distances.emplace(startNode, 0);
-
-			while (!queue.empty()) {
-				const int currentNode = queue.top().second;
-				const int currentDistance = queue.top().first;
-				queue.pop();
+			const int nodesCount{ static_cast<int>(offsets.size()) - 1 };
+			const int threadsCount{ Parallel::getThreadsCount() };
+			colors.assign(nodesCount, -1);
+			order.clear();
+			order.reserve(nodesCount);
 
-				if (const auto it{ graph.getAdjacencyList().find(currentNode) }; it != graph.getAdjacencyList().end()) {
-					for (const int node : it->second) {
-						const int distance{ graph.getEdgeWeight(currentNode, node) };
-						if ((distances[node].has_value() && currentDistance + distance < distances[node]) || !distances[node].has_value()) {
-							distances[node] = currentDistance + distance;
-							queue.push({ *distances[node], node });
+			// Priorities are hashes of the node indices (splitmix64), so they are random but the same on every run
+			std::vector<std::uint64_t> priorities(nodesCount);
+			Parallel::parallelFor(0, nodesCount, [&priorities](int chunkBegin, int chunkEnd, int) {
+				for (int node{ chunkBegin }; node < chunkEnd; ++node) {
+					std::uint64_t priority{ static_cast<std::uint64_t>(node) + 0x9e3779b97f4a7c15ull };
+					priority = (priority ^ (priority >> 30)) * 0xbf58476d1ce4e5b9ull;
+					priority = (priority ^ (priority >> 27)) * 0x94d049bb133111ebull;
+					priorities[node] = priority ^ (priority >> 31);
+				}
+				}, threadsCount);
+			auto hasHigherPriority = [&priorities](int a, int b) {
+				return priorities[a] > priorities[b] || (priorities[a] == priorities[b] && a < b);
+			};
 
-							paths[node] = paths[currentNode];
-							paths[node].push_back(currentNode);
-						}
+			// Neighbors with higher priorities which are not colored yet
+			std::vector<std::atomic<int>> waitingCounts(nodesCount);
+			// Nodes which can be colored in the next round, found by each thread
+			std::vector<std::vector<int>> threadsReadyNodes(threadsCount);
+			Parallel::parallelFor(0, nodesCount, [&](int chunkBegin, int chunkEnd, int threadIdx) {
+				for (int node{ chunkBegin }; node < chunkEnd; ++node) {
+					int waitingCount{ 0 };
+					for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+						waitingCount += hasHigherPriority(neighbors[i], node);
+					}
+					waitingCounts[node].store(waitingCount, std::memory_order_relaxed);
+					if (waitingCount == 0) {
+						threadsReadyNodes[threadIdx].push_back(node);
 					}
 				}
+				}, threadsCount);
+
+			int maxDegree{ 0 };
+			for (int node{ 0 }; node < nodesCount; ++node) {
+				maxDegree = std::max(maxDegree, offsets[node + 1] - offsets[node]);
 			}
+			std::vector<std::vector<int>> threadsForbiddenStamps(threadsCount, std::vector<int>(static_cast<std::size_t>(maxDegree) + 1, -1));
 
-			if (distances[endNode].has_value()) {
-				int lastNode{ startNode };
-				for (const int node : paths[endNode]) {
-					traversalOrder.nodeOrder.push_back(node);
-					traversalOrder.edgeOrder.push_back({ lastNode, node });
-					lastNode = node;
+			std::vector<int> round;
+			auto collectRound = [&]() {
+				round.clear();
+				for (std::vector<int>& readyNodes : threadsReadyNodes) {
+					round.insert(round.end(), readyNodes.begin(), readyNodes.end());
+					readyNodes.clear();
 				}
-				traversalOrder.nodeOrder.push_back(endNode);
-				traversalOrder.edgeOrder.push_back({ lastNode, endNode });
+				// Threads find the nodes in any order
+				std::sort(round.begin(), round.end());
+			};
+
+			collectRound();
+			while (!round.empty()) {
+				order.insert(order.end(), round.begin(), round.end());
+				Parallel::parallelFor(0, static_cast<int>(round.size()), [&](int chunkBegin, int chunkEnd, int threadIdx) {
+					std::vector<int>& forbiddenStamps{ threadsForbiddenStamps[threadIdx] };
+					for (int i{ chunkBegin }; i < chunkEnd; ++i) {
+						const int node{ round[i] };
+						// Neighbors with higher priorities were colored in the previous rounds
+						for (int j{ offsets[node] }; j < offsets[node + 1]; ++j) {
+							if (hasHigherPriority(neighbors[j], node)) {
+								forbiddenStamps[colors[neighbors[j]]] = node;
+							}
+						}
+						int color{ 0 };
+						while (forbiddenStamps[color] == node) {
+							++color;
+						}
+						colors[node] = color;
+
+						for (int j{ offsets[node] }; j < offsets[node + 1]; ++j) {
+							const int neighbor{ neighbors[j] };
+							if (hasHigherPriority(node, neighbor) && waitingCounts[neighbor].fetch_sub(1, std::memory_order_relaxed) == 1) {
+								threadsReadyNodes[threadIdx].push_back(neighbor);
+							}
+						}
+					}
+					}, threadsCount);
+				collectRound();
 			}
+
+			return colors.empty() ? 0 : *std::max_element(colors.begin(), colors.end()) + 1;
 		}
 
-		void coloringImpl(const Graph& graph, TraversalOrder& traversalOrder, NodesColorsIdxs& nodesColorsIdxs)
+		// Afforest: the trees are first linked along a few neighbors of every node, which usually joins most of the nodes into one large tree.
+		// Nodes of the large tree don't have to check their remaining edges, the edges to it are found from the other side.
+		// Trees are always linked under the smaller node, so every root is the smallest node of its component.
+		void connectedComponentsImpl(const GraphSnapshot& graph, int threadsCount, ConnectedComponents& components)
 		{
-			std::map<int, bool> availableColorsIdxs;
+			constexpr int sampledNeighborsCount{ 2 };
+			constexpr int largestComponentSamplesCount{ 1024 };
 
-			for (const Node& node : graph.getNodes()) {
-				nodesColorsIdxs[node.id] = 0;
-				traversalOrder.nodeOrder.push_back(node.id);
-				break;
-			}
+			const int nodesCount{ graph.getNodesCount() };
+			// Edges are treated as undirected, nodes outside of the large tree check their incoming edges as well
+			const int directionsCount{ graph.isDirected() ? 2 : 1 };
+			const std::vector<int>* offsets[2]{ &graph.getOffsets(), &graph.getInOffsets() };
+			const std::vector<int>* neighbors[2]{ &graph.getNeighbors(), &graph.getInNeighbors() };
 
-			for (int i{ 0 }; i < graph.getNodes().size(); ++i) {
-				availableColorsIdxs.emplace(i, false);
+			std::vector<std::atomic<int>> parents(nodesCount);
+			for (int node{ 0 }; node < nodesCount; ++node) {
+				parents[node].store(node, std::memory_order_relaxed);
 			}
 
-			bool firstLoop{ true };
-			for (const Node& node : graph.getNodes()) {
-				if (firstLoop) {
-					firstLoop = false;
-					continue;
+			auto link = [&parents](int a, int b) {
+				int parentA{ parents[a].load(std::memory_order_relaxed) };
+				int parentB{ parents[b].load(std::memory_order_relaxed) };
+				while (parentA != parentB) {
+					const int high{ std::max(parentA, parentB) };
+					const int low{ std::min(parentA, parentB) };
+					int highParent{ parents[high].load(std::memory_order_relaxed) };
+					if (highParent == low) {
+						break;
+					}
+					// Only a root can be attached, otherwise continue from the grandparents
+					if (highParent == high && parents[high].compare_exchange_strong(highParent, low, std::memory_order_relaxed)) {
+						break;
+					}
+					parentA = parents[parents[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+					parentB = parents[low].load(std::memory_order_relaxed);
 				}
+			};
 
-				if (const auto it{ graph.getAdjacencyList().find(node.id) }; it != graph.getAdjacencyList().end()) {
-					for (const int nodeId : it->second) {
-						if (nodesColorsIdxs[nodeId].has_value()) {
-							availableColorsIdxs[*nodesColorsIdxs[nodeId]] = true;
+			auto compress = [&]() {
+				Parallel::parallelFor(0, nodesCount, [&parents](int chunkBegin, int chunkEnd, int) {
+					for (int node{ chunkBegin }; node < chunkEnd; ++node) {
+						int parent{ parents[node].load(std::memory_order_relaxed) };
+						while (parents[parent].load(std::memory_order_relaxed) != parent) {
+							parent = parents[parent].load(std::memory_order_relaxed);
 						}
+						parents[node].store(parent, std::memory_order_relaxed);
 					}
+					}, threadsCount);
+			};
 
-					int availableColorIdx{ 0 };
-					for (availableColorIdx; availableColorIdx < graph.getNodes().size(); ++availableColorIdx) {
-						if (!availableColorsIdxs[availableColorIdx]) {
-							break;
+			const auto& forwardOffsets{ *offsets[0] };
+			const auto& forwardNeighbors{ *neighbors[0] };
+			for (int round{ 0 }; round < sampledNeighborsCount; ++round) {
+				Parallel::parallelFor(0, nodesCount, [&](int chunkBegin, int chunkEnd, int) {
+					for (int node{ chunkBegin }; node < chunkEnd; ++node) {
+						if (forwardOffsets[node] + round < forwardOffsets[node + 1]) {
+							link(node, forwardNeighbors[forwardOffsets[node] + round]);
 						}
 					}
+					}, threadsCount);
+				compress();
+			}
+
+			// The most frequent root among the sampled nodes is most likely the root of the large tree
+			int largestRoot{ -1 };
+			if (nodesCount > 0) {
+				std::mt19937 generator{ 1 };
+				std::uniform_int_distribution<int> nodeDistribution{ 0, nodesCount - 1 };
+				std::vector<int> sampledRoots(largestComponentSamplesCount);
+				for (int& root : sampledRoots) {
+					root = parents[nodeDistribution(generator)].load(std::memory_order_relaxed);
+				}
+				std::sort(sampledRoots.begin(), sampledRoots.end());
+
+				int largestCount{ 0 };
+				for (std::size_t i{ 0 }, j{ 0 }; i < sampledRoots.size(); i = j) {
+					while (j < sampledRoots.size() && sampledRoots[j] == sampledRoots[i]) {
+						++j;
+					}
+					if (static_cast<int>(j - i) > largestCount) {
+						largestCount = static_cast<int>(j - i);
+						largestRoot = sampledRoots[i];
+					}
+				}
+			}
 
-					nodesColorsIdxs[node.id] = availableColorIdx;
-					traversalOrder.nodeOrder.push_back(node.id);
+			Parallel::parallelFor(0, nodesCount, [&](int chunkBegin, int chunkEnd, int) {
+				for (int node{ chunkBegin }; node < chunkEnd; ++node) {
+					if (parents[node].load(std::memory_order_relaxed) == largestRoot) {
+						continue;
+					}
 
-					for (const int nodeId : it->second) {
-						if (nodesColorsIdxs[nodeId].has_value()) {
-							availableColorsIdxs[*nodesColorsIdxs[nodeId]] = false;
+					for (int direction{ 0 }; direction < directionsCount; ++direction) {
+						// Sampled neighbors were linked already
+						const int firstNeighbor{ direction == 0 ? sampledNeighborsCount : 0 };
+						for (int i{ (*offsets[direction])[node] + firstNeighbor }; i < (*offsets[direction])[node + 1]; ++i) {
+							link(node, (*neighbors[direction])[i]);
 						}
 					}
 				}
+				}, threadsCount);
+			compress();
+
+			// Roots are the smallest nodes of the components, so they are numbered before the other nodes of their components
+			components.componentsIdxs.assign(nodesCount, 0);
+			components.componentsCount = 0;
+			for (int node{ 0 }; node < nodesCount; ++node) {
+				const int root{ parents[node].load(std::memory_order_relaxed) };
+				components.componentsIdxs[node] = (root == node) ? components.componentsCount++ : components.componentsIdxs[root];
 			}
 		}
 
-		void kruskalMSTImpl(const Graph& graph, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
+		// Appends the spanning tree edges, given as snapshot node indices in the order in which they join the trees
+		void appendSpanningTreeEdges(const GraphSnapshot& graph, const std::vector<Edge>& edges, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
 		{
-			std::vector<int> parent;
-			for (int i{ 0 }; i < graph.getNodes().size() + graph.getEdges().size(); ++i) {
-				parent.push_back(i);
+			for (const Edge& edge : edges) {
+				if (!visitedNodes[edge.a]) {
+					traversalOrder.nodeOrder.push_back(graph.getNodeId(edge.a));
+					visitedNodes[edge.a] = true;
+				}
+				if (!visitedNodes[edge.b]) {
+					traversalOrder.nodeOrder.push_back(graph.getNodeId(edge.b));
+					visitedNodes[edge.b] = true;
+				}
+
+				traversalOrder.edgeOrder.push_back({ graph.getNodeId(edge.a), graph.getNodeId(edge.b) });
 			}
+		}
 
+		template<Directed directed, Weighted weighted>
+		void kruskalMSTImpl(const GraphSnapshot& graph, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
+		{
 			const auto edgesSortedByWeight = [&graph]() {
+				const auto& offsets{ graph.getOffsets() };
+				const auto& neighbors{ graph.getNeighbors() };
+				const auto& weights{ graph.getWeights() };
+
+				// Edge endpoints are snapshot node indices
 				std::vector<Edge> edges;
-				for (const auto& edge : graph.getEdges()) {
-					edges.push_back(edge);
-				}
-				std::sort(edges.begin(), edges.end(), [](const auto& edge1, const auto& edge2) {
-					if (edge1.weight < edge2.weight) {
-						return true;
-					}
-					else if (edge1.weight > edge2.weight) {
-						return false;
+				edges.reserve(graph.getEdgesCount());
+				for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+					for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+						// Undirected edges are stored in both rows, take them only once
+						if (directed == Directed::Yes || node <= neighbors[i]) {
+							edges.push_back(Edge{ node, neighbors[i], weighted == Weighted::Yes ? weights[i] : 1 });
+						}
 					}
-					else {
-						return edge1 < edge2;
+				}
+
+				// Edges are collected in ascending (a, b) order already, so with equal weights they don't have to be sorted
+				if constexpr (weighted == Weighted::Yes) {
+					const long long weightsRange{ static_cast<long long>(graph.getMaxWeight()) - graph.getMinWeight() };
+					if (weightsRange <= Helpers::kruskalCountingSortMaxRange) {
+						// Counting sort is stable, so edges with equal weights stay in (a, b) order
+						std::vector<int> positions(static_cast<std::size_t>(weightsRange) + 2, 0);
+						for (const Edge& edge : edges) {
+							++positions[edge.weight - graph.getMinWeight() + 1];
+						}
+						for (std::size_t i{ 1 }; i < positions.size(); ++i) {
+							positions[i] += positions[i - 1];
+						}
+
+						std::vector<Edge> sortedEdges(edges.size(), Edge{ 0, 0 });
+						for (const Edge& edge : edges) {
+							sortedEdges[positions[edge.weight - graph.getMinWeight()]++] = edge;
+						}
+						return sortedEdges;
 					}
-					});
+
+					std::sort(edges.begin(), edges.end(), [](const auto& edge1, const auto& edge2) {
+						if (edge1.weight < edge2.weight) {
+							return true;
+						}
+						else if (edge1.weight > edge2.weight) {
+							return false;
+						}
+						else {
+							return edge1 < edge2;
+						}
+						});
+				}
 				return edges;
 			}();
 
-			auto getRoot = [&parent](int nodeId) {
-				while (parent[nodeId] != nodeId) {
-					parent[nodeId] = parent[parent[nodeId]];
-					nodeId = parent[nodeId];
+			UnionFind trees{ graph.getNodesCount() };
+			std::vector<Edge> treeEdges;
+			for (const Edge& edge : edgesSortedByWeight) {
+				if (trees.unite(edge.a, edge.b)) {
+					treeEdges.push_back(edge);
+				}
+			}
+
+			appendSpanningTreeEdges(graph, treeEdges, traversalOrder, visitedNodes);
+		}
+
+		// Grows the trees from the nodes in ascending order, edges are added in the order in which they join a tree.
+		// Ties between the weights are broken by (a, b), so the chosen edges are the same as in Kruskal's algorithm.
+		void primMSTImpl(const GraphSnapshot& graph, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
+		{
+			const int nodesCount{ graph.getNodesCount() };
+			// Directed edges are treated as undirected, so incoming edges have to be checked as well
+			const int directionsCount{ graph.isDirected() ? 2 : 1 };
+			const std::vector<int>* offsets[2]{ &graph.getOffsets(), &graph.getInOffsets() };
+			const std::vector<int>* neighbors[2]{ &graph.getNeighbors(), &graph.getInNeighbors() };
+			const std::vector<int>* weights[2]{ &graph.getWeights(), &graph.getInWeights() };
+
+			// (weight, a, b) of the lightest edge connecting the node to the tree
+			using EdgeKey = std::tuple<int, int, int>;
+			IndexedHeap<EdgeKey> heap{ nodesCount };
+			std::vector<char> nodesInTree(nodesCount, false);
+			// Weight of the key of every node, most of the edges are rejected by this check without touching the heap
+			std::vector<int> lightestWeights(nodesCount, std::numeric_limits<int>::max());
+
+			auto addToTree = [&](int node) {
+				nodesInTree[node] = true;
+				for (int direction{ 0 }; direction < directionsCount; ++direction) {
+					for (int i{ (*offsets[direction])[node] }; i < (*offsets[direction])[node + 1]; ++i) {
+						const int neighbor{ (*neighbors[direction])[i] };
+						if (nodesInTree[neighbor]) {
+							continue;
+						}
+
+						const int weight{ (*weights[direction])[i] };
+						if (weight > lightestWeights[neighbor]) {
+							continue;
+						}
+
+						lightestWeights[neighbor] = weight;
+						if (graph.isDirected()) {
+							heap.pushOrDecreaseKey(neighbor, direction == 0 ? EdgeKey{ weight, node, neighbor } : EdgeKey{ weight, neighbor, node });
+						}
+						else {
+							heap.pushOrDecreaseKey(neighbor, EdgeKey{ weight, std::min(node, neighbor), std::max(node, neighbor) });
+						}
+					}
+				}
+			};
+
+			for (int root{ 0 }; root < nodesCount; ++root) {
+				if (nodesInTree[root]) {
+					continue;
+				}
+
+				addToTree(root);
+				while (!heap.empty()) {
+					const auto [weight, a, b] = heap.topKey();
+					const int node{ heap.pop() };
+					const int parent{ node == a ? b : a };
+
+					// Parent is listed before the node, also for directed edges pointing towards the tree
+					if (!visitedNodes[parent]) {
+						traversalOrder.nodeOrder.push_back(graph.getNodeId(parent));
+						visitedNodes[parent] = true;
+					}
+					traversalOrder.nodeOrder.push_back(graph.getNodeId(node));
+					visitedNodes[node] = true;
+					traversalOrder.edgeOrder.push_back({ graph.getNodeId(a), graph.getNodeId(b) });
+
+					addToTree(node);
 				}
-				return nodeId;
+			}
+		}
+
+		// Every round each tree picks its lightest edge to another tree in parallel, then the trees are joined along these edges.
+		// Edges are ordered by (weight, a, b), like in Kruskal's algorithm, so both choose the same edges.
+		void boruvkaMSTImpl(const GraphSnapshot& graph, TraversalOrder& traversalOrder, VisitedNodes& visitedNodes)
+		{
+			const int nodesCount{ graph.getNodesCount() };
+			const int threadsCount{ Parallel::getThreadsCount() };
+			const auto& offsets{ graph.getOffsets() };
+			const auto& neighbors{ graph.getNeighbors() };
+			const auto& weights{ graph.getWeights() };
+
+			struct TreeEdge
+			{
+				int a{ 0 };
+				int b{ 0 };
+				// (weight, index in allEdges) packed into one word, the edges are collected in (a, b) order
+				std::uint64_t key{ 0 };
 			};
 
-			auto join = [&parent, &getRoot](int a, int b) {
-				const int rootA{ getRoot(a) };
-				const int rootB{ getRoot(b) };
-				parent[rootA] = rootB;
+			std::vector<Edge> allEdges;
+			std::vector<TreeEdge> remainingEdges;
+			for (int node{ 0 }; node < nodesCount; ++node) {
+				for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+					// Undirected edges are stored in both rows, take them only once. Loops never join two trees.
+					if ((graph.isDirected() || node < neighbors[i]) && node != neighbors[i]) {
+						const std::uint32_t shiftedWeight{ static_cast<std::uint32_t>(static_cast<long long>(weights[i]) - graph.getMinWeight()) };
+						remainingEdges.push_back(TreeEdge{ node, neighbors[i], (static_cast<std::uint64_t>(shiftedWeight) << 32) | allEdges.size() });
+						allEdges.push_back(Edge{ node, neighbors[i], weights[i] });
+					}
+				}
+			}
+
+			constexpr std::uint64_t noEdge{ ~std::uint64_t{ 0 } };
+			UnionFind trees{ nodesCount };
+			// Root of the tree of every node, updated after each round
+			std::vector<int> treesRoots(nodesCount);
+			std::iota(treesRoots.begin(), treesRoots.end(), 0);
+			std::vector<std::atomic<std::uint64_t>> lightestEdges(nodesCount);
+			for (std::atomic<std::uint64_t>& lightestEdge : lightestEdges) {
+				lightestEdge.store(noEdge, std::memory_order_relaxed);
+			}
+			std::vector<Edge> treeEdges;
+
+			auto updateLightestEdge = [&lightestEdges](int root, std::uint64_t key) {
+				std::uint64_t lightestEdge{ lightestEdges[root].load(std::memory_order_relaxed) };
+				while (key < lightestEdge && !lightestEdges[root].compare_exchange_weak(lightestEdge, key, std::memory_order_relaxed)) {
+				}
 			};
 
-			for (int i{ 0 }; i < edgesSortedByWeight.size(); ++i) {
-				const int a{ edgesSortedByWeight[i].a };
-				const int b{ edgesSortedByWeight[i].b };
-				if (getRoot(a) != getRoot(b)) {
-					join(a, b);
+			while (!remainingEdges.empty()) {
+				Parallel::parallelFor(0, static_cast<int>(remainingEdges.size()), [&](int edgesBegin, int edgesEnd, int) {
+					for (int i{ edgesBegin }; i < edgesEnd; ++i) {
+						const TreeEdge& edge{ remainingEdges[i] };
+						updateLightestEdge(treesRoots[edge.a], edge.key);
+						updateLightestEdge(treesRoots[edge.b], edge.key);
+					}
+					}, threadsCount);
 
-					if (!visitedNodes[a]) {
-						traversalOrder.nodeOrder.push_back(a);
-						visitedNodes[a] = true;
+				// Two trees can pick the same edge, the second one doesn't join anything
+				for (int root{ 0 }; root < nodesCount; ++root) {
+					const std::uint64_t lightestEdge{ lightestEdges[root].load(std::memory_order_relaxed) };
+					if (lightestEdge == noEdge) {
+						continue;
 					}
-					if (!visitedNodes[b]) {
-						traversalOrder.nodeOrder.push_back(b);
-						visitedNodes[b] = true;
+
+					lightestEdges[root].store(noEdge, std::memory_order_relaxed);
+					const Edge& edge{ allEdges[static_cast<std::uint32_t>(lightestEdge)] };
+					if (trees.unite(edge.a, edge.b)) {
+						treeEdges.push_back(edge);
 					}
+				}
 
-					traversalOrder.edgeOrder.push_back({ a, b });
+				for (int node{ 0 }; node < nodesCount; ++node) {
+					treesRoots[node] = trees.find(node);
 				}
+				// Edges inside one tree won't be needed anymore
+				remainingEdges.erase(std::remove_if(remainingEdges.begin(), remainingEdges.end(), [&treesRoots](const TreeEdge& edge) {
+					return treesRoots[edge.a] == treesRoots[edge.b];
+					}), remainingEdges.end());
 			}
 
+			// Emit the edges in the order in which Kruskal's algorithm would add them
+			std::sort(treeEdges.begin(), treeEdges.end(), [](const Edge& edge1, const Edge& edge2) {
+				return std::tie(edge1.weight, edge1.a, edge1.b) < std::tie(edge2.weight, edge2.a, edge2.b);
+				});
+			appendSpanningTreeEdges(graph, treeEdges, traversalOrder, visitedNodes);
 		}
 	}
 
 	TraversalOrder dfs(const Graph& graph, int startNode)
+	{
+		return dfs(*graph.snapshot(), startNode);
+	}
+
+	TraversalOrder bfs(const Graph& graph, int startNode, ExecutionPolicy executionPolicy)
+	{
+		return bfs(*graph.snapshot(), startNode, executionPolicy);
+	}
+
+	TraversalOrder dijkstra(const Graph& graph, int startNode, int endNode, ShortestPathQueue queue, SearchStatistics* statistics)
+	{
+		return dijkstra(*graph.snapshot(), startNode, endNode, queue, statistics);
+	}
+
+	TraversalOrder aStar(const Graph& graph, int startNode, int endNode, const PositionLookup& getPosition, SearchStatistics* statistics)
+	{
+		return aStar(*graph.snapshot(), startNode, endNode, getPosition, statistics);
+	}
+
+	TraversalOrder bidirectionalDijkstra(const Graph& graph, int startNode, int endNode)
+	{
+		return bidirectionalDijkstra(*graph.snapshot(), startNode, endNode);
+	}
+
+	ShortestPaths shortestPaths(const Graph& graph, int startNode, ExecutionPolicy executionPolicy, int delta)
+	{
+		return shortestPaths(*graph.snapshot(), startNode, executionPolicy, delta);
+	}
+
+	DistanceMatrix allPairsShortestPaths(const Graph& graph, ExecutionPolicy executionPolicy)
+	{
+		return allPairsShortestPaths(*graph.snapshot(), executionPolicy);
+	}
+
+	std::pair<TraversalOrder, NodesColorsIdxs> eccentricities(const Graph& graph, DistancesSummary* summary)
+	{
+		return eccentricities(*graph.snapshot(), summary);
+	}
+
+	std::pair<TraversalOrder, NodesColorsIdxs> coloring(const Graph& graph, ColoringStrategy strategy)
+	{
+		return coloring(*graph.snapshot(), strategy);
+	}
+
+	bool isColoringValid(const Graph& graph, const NodesColorsIdxs& nodesColorsIdxs)
+	{
+		return isColoringValid(*graph.snapshot(), nodesColorsIdxs);
+	}
+
+	ConnectedComponents connectedComponents(const Graph& graph, ExecutionPolicy executionPolicy)
+	{
+		return connectedComponents(*graph.snapshot(), executionPolicy);
+	}
+
+	std::pair<TraversalOrder, NodesColorsIdxs> findIslands(const Graph& graph)
+	{
+		return findIslands(*graph.snapshot());
+	}
+
+	TraversalOrder kruskalMST(const Graph& graph)
+	{
+		return kruskalMST(*graph.snapshot());
+	}
+
+	TraversalOrder primMST(const Graph& graph)
+	{
+		return primMST(*graph.snapshot());
+	}
+
+	TraversalOrder boruvkaMST(const Graph& graph)
+	{
+		return boruvkaMST(*graph.snapshot());
+	}
+
+	std::pair<TraversalOrder, NodesColorsIdxs> nodesDegrees(const Graph& graph)
+	{
+		return nodesDegrees(*graph.snapshot());
+	}
+
+	TraversalOrder dfs(const GraphSnapshot& graph, int startNode)
 	{
 		TraversalOrder traversalOrder;
 		VisitedNodes visitedNodes{ Helpers::createEmptyVisitedNodesContainer(graph) };
 
-		Impl::dfsImpl(graph, startNode, traversalOrder, visitedNodes);
+		if (const int startNodeIdx{ graph.getNodeIdx(startNode) }; startNodeIdx != -1) {
+			Impl::dfsImpl(graph, startNodeIdx, traversalOrder, visitedNodes);
+		}
 
 		return traversalOrder;
 	}
 
-	TraversalOrder bfs(const Graph& graph, int startNode)
+	TraversalOrder bfs(const GraphSnapshot& graph, int startNode, ExecutionPolicy executionPolicy)
 	{
 		TraversalOrder traversalOrder;
-		VisitedNodes visitedNodes{ Helpers::createEmptyVisitedNodesContainer(graph) };
 
-		Impl::bfsImpl(graph, startNode, traversalOrder, visitedNodes);
+		if (const int startNodeIdx{ graph.getNodeIdx(startNode) }; startNodeIdx != -1) {
+			if (executionPolicy == ExecutionPolicy::Parallel) {
+				Impl::parallelBfsImpl(graph, startNodeIdx, traversalOrder);
+			}
+			else {
+				VisitedNodes visitedNodes{ Helpers::createEmptyVisitedNodesContainer(graph) };
+				Impl::bfsImpl(graph, startNodeIdx, traversalOrder, visitedNodes);
+			}
+		}
+
+		return traversalOrder;
+	}
+
+	TraversalOrder dijkstra(const GraphSnapshot& graph, int startNode, int endNode, ShortestPathQueue queue, SearchStatistics* statistics)
+	{
+		TraversalOrder traversalOrder;
+		int expandedNodesCount{ 0 };
+
+		const int startNodeIdx{ graph.getNodeIdx(startNode) };
+		const int endNodeIdx{ graph.getNodeIdx(endNode) };
+		if (startNodeIdx != -1 && endNodeIdx != -1) {
+			if (graph.isWeighted()) {
+				Impl::dijkstraImpl<Weighted::Yes>(graph, startNodeIdx, endNodeIdx, queue, traversalOrder, expandedNodesCount);
+			}
+			else {
+				Impl::dijkstraImpl<Weighted::No>(graph, startNodeIdx, endNodeIdx, queue, traversalOrder, expandedNodesCount);
+			}
+		}
+
+		if (statistics) {
+			statistics->expandedNodesCount = expandedNodesCount;
+		}
+		return traversalOrder;
+	}
+
+	TraversalOrder aStar(const GraphSnapshot& graph, int startNode, int endNode, const PositionLookup& getPosition, SearchStatistics* statistics)
+	{
+		TraversalOrder traversalOrder;
+		int expandedNodesCount{ 0 };
+
+		const int startNodeIdx{ graph.getNodeIdx(startNode) };
+		const int endNodeIdx{ graph.getNodeIdx(endNode) };
+		if (startNodeIdx != -1 && endNodeIdx != -1) {
+			expandedNodesCount = Impl::aStarImpl(graph, startNodeIdx, endNodeIdx, getPosition, traversalOrder);
+		}
 
+		if (statistics) {
+			statistics->expandedNodesCount = expandedNodesCount;
+		}
 		return traversalOrder;
 	}
 
-	TraversalOrder dijkstra(const Graph& graph, int startNode, int endNode)
+	TraversalOrder bidirectionalDijkstra(const GraphSnapshot& graph, int startNode, int endNode)
 	{
 		TraversalOrder traversalOrder;
 
-		Impl::dijkstraImpl(graph, startNode, endNode, traversalOrder);
+		const int startNodeIdx{ graph.getNodeIdx(startNode) };
+		const int endNodeIdx{ graph.getNodeIdx(endNode) };
+		if (startNodeIdx != -1 && endNodeIdx != -1) {
+			Impl::bidirectionalDijkstraImpl(graph, startNodeIdx, endNodeIdx, traversalOrder);
+		}
 
 		return traversalOrder;
 	}
 
-	std::pair<TraversalOrder, NodesColorsIdxs> coloring(const Graph& graph)
+	ShortestPaths shortestPaths(const GraphSnapshot& graph, int startNode, ExecutionPolicy executionPolicy, int delta)
+	{
+		ShortestPaths shortestPaths;
+
+		const int startNodeIdx{ graph.getNodeIdx(startNode) };
+		if (startNodeIdx == -1) {
+			shortestPaths.distances.assign(graph.getNodesCount(), std::numeric_limits<int>::max());
+			shortestPaths.predecessors.assign(graph.getNodesCount(), -1);
+		}
+		else if (executionPolicy == ExecutionPolicy::Parallel && graph.getMinWeight() >= 0) {
+			if (delta <= 0) {
+				// Buckets as wide as the weight of an edge divided by the average degree
+				const int averageDegree{ std::max(1, graph.getNodesCount() > 0 ? static_cast<int>(graph.getNeighbors().size()) / graph.getNodesCount() : 1) };
+				delta = std::max(1, graph.getMaxWeight() / averageDegree);
+			}
+			// There is a bucket for every delta wide range of the weights, so delta is raised to keep them at most as many as the nodes
+			const long long maxBucketsCount{ std::max(1, graph.getNodesCount()) };
+			delta = std::max(delta, static_cast<int>((graph.getMaxWeight() + maxBucketsCount - 1) / maxBucketsCount));
+			Impl::deltaSteppingImpl(graph, startNodeIdx, delta, shortestPaths);
+		}
+		else {
+			shortestPaths.distances.assign(graph.getNodesCount(), std::numeric_limits<int>::max());
+			shortestPaths.predecessors.assign(graph.getNodesCount(), -1);
+			if (Helpers::useBucketQueue(graph, ShortestPathQueue::Automatic)) {
+				Impl::bucketQueueSearch(graph, startNodeIdx, -1, shortestPaths.distances, shortestPaths.predecessors);
+			}
+			else {
+				Impl::binaryHeapSearch(graph, startNodeIdx, -1, shortestPaths.distances, shortestPaths.predecessors);
+			}
+		}
+
+		return shortestPaths;
+	}
+
+	DistanceMatrix allPairsShortestPaths(const GraphSnapshot& graph, ExecutionPolicy executionPolicy)
+	{
+		const int nodesCount{ graph.getNodesCount() };
+		const int stride{ (nodesCount + DistanceMatrix::tileSize - 1) / DistanceMatrix::tileSize * DistanceMatrix::tileSize };
+		DistanceMatrix distanceMatrix;
+		distanceMatrix.nodesCount = nodesCount;
+
+		// Rows are moved to the front in place, every row ends up before the place it's read from. The capacity of the padded
+		// matrix is kept, shrinking it would mean one more copy of the whole matrix.
+		auto compactRows = [nodesCount, stride](auto& matrix) {
+			for (int node{ 0 }; node < nodesCount; ++node) {
+				const auto row{ matrix.begin() + static_cast<std::size_t>(node) * stride };
+				std::copy(row, row + nodesCount, matrix.begin() + static_cast<std::size_t>(node) * nodesCount);
+			}
+			matrix.resize(static_cast<std::size_t>(nodesCount) * nodesCount);
+		};
+
+		// No path is longer than nodesCount - 1 edges of the largest weight
+		const long long longestPath{ static_cast<long long>(std::max(0, nodesCount - 1)) * std::max(0, graph.getMaxWeight()) };
+		if (graph.getMinWeight() >= 0 && longestPath < DistanceMatrix::intUnreachable) {
+			distanceMatrix.intDistances = Impl::floydWarshall<int, false>(graph, stride, executionPolicy);
+			compactRows(distanceMatrix.intDistances);
+			return distanceMatrix;
+		}
+
+		auto& matrix{ distanceMatrix.longDistances };
+		matrix = graph.getMinWeight() >= 0 ? Impl::floydWarshall<long long, false>(graph, stride, executionPolicy) :
+			Impl::floydWarshall<long long, true>(graph, stride, executionPolicy);
+		for (int node{ 0 }; node < nodesCount; ++node) {
+			distanceMatrix.hasNegativeCycle = distanceMatrix.hasNegativeCycle || matrix[static_cast<std::size_t>(node) * stride + node] < 0;
+		}
+		compactRows(matrix);
+		return distanceMatrix;
+	}
+
+	DistancesSummary summarizeDistances(const DistanceMatrix& distanceMatrix)
+	{
+		DistancesSummary summary;
+		summary.hasNegativeCycle = distanceMatrix.hasNegativeCycle;
+		summary.eccentricities.assign(distanceMatrix.nodesCount, 0);
+		for (int a{ 0 }; a < distanceMatrix.nodesCount; ++a) {
+			for (int b{ 0 }; b < distanceMatrix.nodesCount; ++b) {
+				const long long distance{ distanceMatrix.getDistance(a, b) };
+				if (distance != DistanceMatrix::unreachable) {
+					summary.eccentricities[a] = std::max(summary.eccentricities[a], distance);
+				}
+			}
+		}
+
+		if (!summary.eccentricities.empty()) {
+			const auto [minIt, maxIt] { std::minmax_element(summary.eccentricities.begin(), summary.eccentricities.end()) };
+			summary.radius = *minIt;
+			summary.diameter = *maxIt;
+		}
+		return summary;
+	}
+
+	std::pair<TraversalOrder, NodesColorsIdxs> eccentricities(const GraphSnapshot& graph, DistancesSummary* summary)
 	{
 		TraversalOrder traversalOrder;
+		traversalOrder.instant = true;
 		NodesColorsIdxs nodesColorsIdxs;
 
-		Impl::coloringImpl(graph, traversalOrder, nodesColorsIdxs);
+		DistancesSummary distancesSummary{ summarizeDistances(allPairsShortestPaths(graph, ExecutionPolicy::Parallel)) };
+
+		// Same colors for the same eccentricities, like in nodesDegrees
+		std::map<long long, int> eccentricitiesColorsIdxs;
+		int idx{ 0 };
+		for (const long long eccentricity : distancesSummary.eccentricities) {
+			if (eccentricitiesColorsIdxs.insert({ eccentricity, idx }).second) {
+				++idx;
+			}
+		}
+		for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+			traversalOrder.nodeOrder.push_back(graph.getNodeId(node));
+			nodesColorsIdxs.emplace(graph.getNodeId(node), eccentricitiesColorsIdxs[distancesSummary.eccentricities[node]]);
+		}
 
+		if (summary) {
+			*summary = std::move(distancesSummary);
+		}
 		return { traversalOrder, nodesColorsIdxs };
 	}
 
-	std::pair<TraversalOrder, NodesColorsIdxs> findIslands(const Graph& graph)
+	std::pair<TraversalOrder, NodesColorsIdxs> coloring(const GraphSnapshot& graph, ColoringStrategy strategy)
 	{
+		std::vector<int> offsets;
+		std::vector<int> neighbors;
+		Helpers::createUndirectedRows(graph, offsets, neighbors);
+
+		std::vector<int> order;
+		std::vector<int> colors;
+		switch (strategy) {
+		case ColoringStrategy::Greedy:
+			order.resize(graph.getNodesCount());
+			std::iota(order.begin(), order.end(), 0);
+			Impl::greedyColoringImpl(offsets, neighbors, order, colors);
+			break;
+		case ColoringStrategy::SmallestLast:
+			order = Impl::smallestLastOrder(offsets, neighbors);
+			Impl::greedyColoringImpl(offsets, neighbors, order, colors);
+			break;
+		case ColoringStrategy::DSatur:
+			Impl::dsaturColoringImpl(offsets, neighbors, order, colors);
+			break;
+		case ColoringStrategy::JonesPlassmann:
+			Impl::jonesPlassmannColoringImpl(offsets, neighbors, order, colors);
+			break;
+		}
+
+		// Nodes are animated in the order in which they were colored
 		TraversalOrder traversalOrder;
+		traversalOrder.nodeOrder.reserve(order.size());
+		for (const int node : order) {
+			traversalOrder.nodeOrder.push_back(graph.getNodeId(node));
+		}
+
 		NodesColorsIdxs nodesColorsIdxs;
-		VisitedNodes visitedNodes{ Helpers::createEmptyVisitedNodesContainer(graph) };
+		for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+			nodesColorsIdxs.emplace_hint(nodesColorsIdxs.end(), graph.getNodeId(node), colors[node]);
+		}
+
+		return { traversalOrder, nodesColorsIdxs };
+	}
+
+	bool isColoringValid(const GraphSnapshot& graph, const NodesColorsIdxs& nodesColorsIdxs)
+	{
+		if (static_cast<int>(nodesColorsIdxs.size()) != graph.getNodesCount()) {
+			return false;
+		}
 
-		int colorIdx{ 0 };
-		for (const auto [nodeId, visited] : visitedNodes) {
-			if (!visited) {
-				TraversalOrder tempTraversalOrder;
-				Impl::dfsImpl(graph, nodeId, tempTraversalOrder, visitedNodes);
+		// Ids in the map and the node indices are both in ascending order
+		std::vector<int> colors;
+		colors.reserve(nodesColorsIdxs.size());
+		for (const auto& [nodeId, colorIdx] : nodesColorsIdxs) {
+			if (!colorIdx.has_value() || graph.getNodeId(static_cast<int>(colors.size())) != nodeId) {
+				return false;
+			}
+			colors.push_back(*colorIdx);
+		}
 
-				for (const int nodeId : tempTraversalOrder.nodeOrder) {
-					nodesColorsIdxs[nodeId] = colorIdx;
+		// Every edge is in a row of at least one of its nodes
+		const auto& offsets{ graph.getOffsets() };
+		const auto& neighbors{ graph.getNeighbors() };
+		std::atomic<bool> isValid{ true };
+		Parallel::parallelFor(0, graph.getNodesCount(), [&](int chunkBegin, int chunkEnd, int) {
+			for (int node{ chunkBegin }; node < chunkEnd && isValid.load(std::memory_order_relaxed); ++node) {
+				for (int i{ offsets[node] }; i < offsets[node + 1]; ++i) {
+					if (neighbors[i] != node && colors[neighbors[i]] == colors[node]) {
+						isValid.store(false, std::memory_order_relaxed);
+						break;
+					}
 				}
-				++colorIdx;
-				traversalOrder += std::move(tempTraversalOrder);
 			}
+			});
+		return isValid.load();
+	}
+
+	ConnectedComponents connectedComponents(const GraphSnapshot& graph, ExecutionPolicy executionPolicy)
+	{
+		ConnectedComponents components;
+		Impl::connectedComponentsImpl(graph, executionPolicy == ExecutionPolicy::Parallel ? Parallel::getThreadsCount() : 1, components);
+		return components;
+	}
+
+	std::pair<TraversalOrder, NodesColorsIdxs> findIslands(const GraphSnapshot& graph)
+	{
+		const ConnectedComponents components{ connectedComponents(graph, ExecutionPolicy::Parallel) };
+		std::vector<int> nodesIds(graph.getNodesCount());
+		for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+			nodesIds[node] = graph.getNodeId(node);
 		}
 
-		traversalOrder.edgeOrder.clear();
-		return { traversalOrder, nodesColorsIdxs };
+		return Helpers::createIslandsResult(nodesIds, components.componentsIdxs, components.componentsCount);
 	}
 
-	TraversalOrder kruskalMST(const Graph& graph)
+	TraversalOrder kruskalMST(const GraphSnapshot& graph)
 	{
 		TraversalOrder traversalOrder;
 		VisitedNodes visitedNodes{ Helpers::createEmptyVisitedNodesContainer(graph) };
 
-		Impl::kruskalMSTImpl(graph, traversalOrder, visitedNodes);
+		if (graph.isDirected()) {
+			if (graph.isWeighted()) {
+				Impl::kruskalMSTImpl<Directed::Yes, Weighted::Yes>(graph, traversalOrder, visitedNodes);
+			}
+			else {
+				Impl::kruskalMSTImpl<Directed::Yes, Weighted::No>(graph, traversalOrder, visitedNodes);
+			}
+		}
+		else {
+			if (graph.isWeighted()) {
+				Impl::kruskalMSTImpl<Directed::No, Weighted::Yes>(graph, traversalOrder, visitedNodes);
+			}
+			else {
+				Impl::kruskalMSTImpl<Directed::No, Weighted::No>(graph, traversalOrder, visitedNodes);
+			}
+		}
+
+		return traversalOrder;
+	}
+
+	TraversalOrder primMST(const GraphSnapshot& graph)
+	{
+		TraversalOrder traversalOrder;
+		VisitedNodes visitedNodes{ Helpers::createEmptyVisitedNodesContainer(graph) };
+		Impl::primMSTImpl(graph, traversalOrder, visitedNodes);
+		return traversalOrder;
+	}
 
+	TraversalOrder boruvkaMST(const GraphSnapshot& graph)
+	{
+		TraversalOrder traversalOrder;
+		VisitedNodes visitedNodes{ Helpers::createEmptyVisitedNodesContainer(graph) };
+		Impl::boruvkaMSTImpl(graph, traversalOrder, visitedNodes);
 		return traversalOrder;
 	}
 
-	std::pair<TraversalOrder, NodesColorsIdxs> nodesDegrees(const Graph& graph)
+	std::pair<TraversalOrder, NodesColorsIdxs> nodesDegrees(const GraphSnapshot& graph)
 	{
 		TraversalOrder traversalOrder;
 		traversalOrder.instant = true;
@@ -291,14 +1947,14 @@ namespace GraphAlgorithms
 
 		std::map<int, int> degrees;
 		int idx{ 0 };
-		for (const auto& [nodeId, nodeConnections] : graph.getAdjacencyList()) {
-			if (degrees.insert({ static_cast<int>(nodeConnections.size()), idx }).second) {
+		for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+			if (degrees.insert({ graph.getDegree(node), idx }).second) {
 				++idx;
 			}
 		}
-		for (const auto& [nodeId, nodeConnections] : graph.getAdjacencyList()) {
-			traversalOrder.nodeOrder.push_back(nodeId);
-			nodesColorsIdxs.emplace(nodeId, degrees[nodeConnections.size()]);
+		for (int node{ 0 }; node < graph.getNodesCount(); ++node) {
+			traversalOrder.nodeOrder.push_back(graph.getNodeId(node));
+			nodesColorsIdxs.emplace(graph.getNodeId(node), degrees[graph.getDegree(node)]);
 		}
 
 		return { traversalOrder, nodesColorsIdxs };
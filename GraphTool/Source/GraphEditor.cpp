@@ -4,6 +4,7 @@
 #include "../Include/Utilities.hpp"
 #include "../Include/ResourceManager.hpp"
 #include <algorithm>
+#include <unordered_map>
 
 GraphEditor::GraphEditor(Graph& graph, sf::RenderWindow& window)
 	: graph(graph), window(window)
@@ -325,6 +326,37 @@ std::pair<GraphEdgeShape*, GraphEdgeShape*> GraphEditor::createNewEdge(int a, in
 	return { directedEdgeShapePtr, undirectedEdgeShapePtr };
 }
 
+void GraphEditor::createEdgesShapes()
+{
+	std::unordered_map<int, sf::Vector2f> nodesPositions;
+	nodesPositions.reserve(nodesShapes.size());
+	for (const GraphNodeShape& nodeShape : nodesShapes) {
+		nodesPositions.emplace(nodeShape.getNodeId(), nodeShape.getShape().getPosition());
+	}
+	const Weighted weighted{ graph.isWeighted() ? Weighted::Yes : Weighted::No };
+
+	const std::vector<Edge> directedEdges{ graph.buildDirectedEdges() };
+	directedEdgesShapes.reserve(directedEdgesShapes.size() + directedEdges.size());
+	for (const Edge& edge : directedEdges) {
+		directedEdgesShapes.push_back(GraphEdgeShape{ nodesPositions[edge.a], nodesPositions[edge.b], edge.a, edge.b, Directed::Yes, weighted });
+		directedEdgesShapes.back().setWeight(edge.weight);
+
+		// If there are edges A -> B and B -> A, set these edges shapes to use orthogonal offset to prevent them from overlapping each other
+		if (graph.doesDirectedEdgeExist(edge.b, edge.a)) {
+			directedEdgesShapes.back().makeOrthogonalOffsetEnabled();
+		}
+	}
+
+	const std::vector<Edge> undirectedEdges{ graph.buildUndirectedEdges() };
+	undirectedEdgesShapes.reserve(undirectedEdgesShapes.size() + undirectedEdges.size());
+	for (const Edge& edge : undirectedEdges) {
+		// Undirected edge shape has the same direction as the first directed edge connecting its nodes
+		const auto [a, b] { graph.doesDirectedEdgeExist(edge.a, edge.b) ? std::pair{ edge.a, edge.b } : std::pair{ edge.b, edge.a } };
+		undirectedEdgesShapes.push_back(GraphEdgeShape{ nodesPositions[a], nodesPositions[b], a, b, Directed::No, weighted });
+		undirectedEdgesShapes.back().setWeight(edge.weight);
+	}
+}
+
 void GraphEditor::startEditingEdgeWeightIfRequired(const sf::Vector2f& mousePosition)
 {
 	auto startEditingEdgeWeight = [this, &mousePosition](auto& edgesShapes) {
@@ -0,0 +1,37 @@
+#include "../Include/GraphJournal.hpp"
+
+void GraphJournal::setCapacity(std::size_t newCapacity)
+{
+	capacity = newCapacity;
+	while (changes.size() > capacity) {
+		changes.pop_front();
+	}
+}
+
+void GraphJournal::record(GraphChange::Type type, int a, int b, int weight)
+{
+	++version;
+	if (capacity == 0) {
+		return;
+	}
+
+	if (changes.size() == capacity) {
+		changes.pop_front();
+	}
+	changes.push_back(GraphChange{ type, version, a, b, weight });
+}
+
+std::optional<std::vector<GraphChange>> GraphJournal::getChangesSince(std::uint64_t sinceVersion) const
+{
+	if (sinceVersion >= version) {
+		return std::vector<GraphChange>{};
+	}
+
+	// Versions of the journaled changes are consecutive, so the first required change is found directly
+	if (changes.empty() || changes.front().version > sinceVersion + 1) {
+		return std::nullopt;
+	}
+
+	const auto first{ changes.begin() + static_cast<std::ptrdiff_t>(sinceVersion + 1 - changes.front().version) };
+	return std::vector<GraphChange>(first, changes.end());
+}
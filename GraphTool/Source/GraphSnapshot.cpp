@@ -0,0 +1,84 @@
+#include "../Include/GraphSnapshot.hpp"
+#include "../Include/Graph.hpp"
+#include <algorithm>
+
+GraphSnapshot::GraphSnapshot(const Graph& graph)
+	: version{ graph.version() }, directed{ graph.isDirected() }, weighted{ graph.isWeighted() }
+{
+	// Remap node ids to dense indices
+	nodesIds = graph.getNodes().getSortedIds();
+
+	if (!nodesIds.empty() && static_cast<long long>(nodesIds.back()) - nodesIds.front() < 2LL * getNodesCount() + 64) {
+		firstNodeId = nodesIds.front();
+		nodesIdxs.assign(nodesIds.back() - firstNodeId + 1, -1);
+		for (int i{ 0 }; i < getNodesCount(); ++i) {
+			nodesIdxs[nodesIds[i] - firstNodeId] = i;
+		}
+	}
+
+	// Neighbors are listed in ascending id order, which is the ascending index order as well, so every row is sorted
+	offsets.reserve(nodesIds.size() + 1);
+	offsets.push_back(0);
+	for (const int nodeId : nodesIds) {
+		graph.forEachNeighbor(nodeId, [this, nodeId](int neighborId, int weight) {
+			neighbors.push_back(getNodeIdx(neighborId));
+			weights.push_back(weighted ? weight : 1);
+			// Undirected edges are stored in both rows, count them only once
+			if (directed || nodeId <= neighborId) {
+				++edgesCount;
+			}
+			});
+		offsets.push_back(static_cast<int>(neighbors.size()));
+	}
+
+	if (!weights.empty()) {
+		const auto [minIt, maxIt] { std::minmax_element(weights.begin(), weights.end()) };
+		minWeight = *minIt;
+		maxWeight = *maxIt;
+	}
+
+	// Transpose the outgoing rows, visiting the sources in ascending order keeps the incoming rows sorted
+	if (directed) {
+		inOffsets.assign(nodesIds.size() + 1, 0);
+		for (const int neighborIdx : neighbors) {
+			++inOffsets[neighborIdx + 1];
+		}
+		for (int i{ 0 }; i < getNodesCount(); ++i) {
+			inOffsets[i + 1] += inOffsets[i];
+		}
+
+		inNeighbors.resize(neighbors.size());
+		inWeights.resize(weights.size());
+		std::vector<int> rowsEnds(inOffsets.begin(), inOffsets.end() - 1);
+		for (int nodeIdx{ 0 }; nodeIdx < getNodesCount(); ++nodeIdx) {
+			for (int i{ offsets[nodeIdx] }; i < offsets[nodeIdx + 1]; ++i) {
+				const int j{ rowsEnds[neighbors[i]]++ };
+				inNeighbors[j] = nodeIdx;
+				inWeights[j] = weights[i];
+			}
+		}
+	}
+}
+
+std::size_t GraphSnapshot::getAllocatedBytes() const
+{
+	std::size_t intsCount{ 0 };
+	for (const std::vector<int>* array : { &nodesIds, &nodesIdxs, &offsets, &neighbors, &weights, &inOffsets, &inNeighbors, &inWeights }) {
+		intsCount += array->capacity();
+	}
+	return intsCount * sizeof(int);
+}
+
+int GraphSnapshot::getNodeIdx(int nodeId) const
+{
+	if (nodesIdxs.empty()) {
+		const auto it{ std::lower_bound(nodesIds.begin(), nodesIds.end(), nodeId) };
+		return it != nodesIds.end() && *it == nodeId ? static_cast<int>(it - nodesIds.begin()) : -1;
+	}
+
+	const int offset{ nodeId - firstNodeId };
+	if (offset < 0 || offset >= static_cast<int>(nodesIdxs.size())) {
+		return -1;
+	}
+	return nodesIdxs[offset];
+}
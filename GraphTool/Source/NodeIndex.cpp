@@ -0,0 +1,82 @@
+#include "../Include/NodeIndex.hpp"
+#include <algorithm>
+
+int NodeIndex::insert(int nodeId)
+{
+	if (nodeId < 0) {
+		return -1;
+	}
+
+	if (nodeId >= static_cast<int>(slots.size())) {
+		slots.resize(nodeId + 1);
+	}
+
+	Slot& slot{ slots[nodeId] };
+	if (slot.idx == -1) {
+		slot.idx = static_cast<int>(ids.size());
+		ids.push_back(nodeId);
+		if (sortedIds.empty() || sortedIds.back() < nodeId) {
+			sortedIds.push_back(nodeId);
+		}
+		else {
+			sortedIds.insert(std::lower_bound(sortedIds.begin(), sortedIds.end(), nodeId), nodeId);
+		}
+	}
+	return slot.idx;
+}
+
+void NodeIndex::erase(int nodeId)
+{
+	const int idx{ getIdx(nodeId) };
+	if (idx == -1) {
+		return;
+	}
+
+	// Move the last node into the freed place
+	const int lastNodeId{ ids.back() };
+	ids[idx] = lastNodeId;
+	slots[lastNodeId].idx = idx;
+	ids.pop_back();
+	sortedIds.erase(std::lower_bound(sortedIds.begin(), sortedIds.end(), nodeId));
+
+	slots[nodeId].idx = -1;
+	++slots[nodeId].generation;
+}
+
+void NodeIndex::reserve(int count, int maxNodeId)
+{
+	ids.reserve(count);
+	sortedIds.reserve(count);
+	slots.reserve(static_cast<std::size_t>(maxNodeId) + 1);
+}
+
+void NodeIndex::clear()
+{
+	for (const int nodeId : ids) {
+		slots[nodeId].idx = -1;
+		++slots[nodeId].generation;
+	}
+	ids.clear();
+	sortedIds.clear();
+}
+
+int NodeIndex::getIdx(int nodeId) const
+{
+	if (nodeId < 0 || nodeId >= static_cast<int>(slots.size())) {
+		return -1;
+	}
+	return slots[nodeId].idx;
+}
+
+NodeIndex::Handle NodeIndex::getHandle(int nodeId) const
+{
+	if (nodeId < 0 || nodeId >= static_cast<int>(slots.size())) {
+		return { nodeId, 0 };
+	}
+	return { nodeId, slots[nodeId].generation };
+}
+
+bool NodeIndex::isValid(const Handle& handle) const
+{
+	return contains(handle.nodeId) && slots[handle.nodeId].generation == handle.generation;
+}
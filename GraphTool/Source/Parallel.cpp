@@ -0,0 +1,116 @@
+#include "../Include/Parallel.hpp"
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+namespace
+{
+	// Worker threads are started once and wait for the tasks of one parallelFor call at a time,
+	// so a call doesn't pay for creating and joining the threads
+	class ThreadPool
+	{
+	public:
+		~ThreadPool()
+		{
+			{
+				const std::lock_guard<std::mutex> lock{ mutex };
+				stopping = true;
+			}
+			tasksReady.notify_all();
+			for (std::thread& worker : workers) {
+				worker.join();
+			}
+		}
+
+		// Returns false without running the tasks if the pool is running the tasks of another call,
+		// which is also the case for calls made from inside a task
+		bool run(int newTasksCount, void (*newCallTask)(void*, int), void* newTask)
+		{
+			std::unique_lock<std::mutex> lock{ mutex };
+			if (busy) {
+				return false;
+			}
+
+			busy = true;
+			while (static_cast<int>(workers.size()) < newTasksCount - 1) {
+				workers.emplace_back([this]() { work(); });
+			}
+			callTask = newCallTask;
+			task = newTask;
+			tasksCount = newTasksCount;
+			nextTaskIdx = 0;
+			unfinishedTasksCount = newTasksCount;
+			tasksReady.notify_all();
+
+			// Calling thread takes the tasks as well instead of only waiting for the workers
+			runAvailableTasks(lock);
+			tasksDone.wait(lock, [this]() { return unfinishedTasksCount == 0; });
+			busy = false;
+			return true;
+		}
+
+	private:
+		void work()
+		{
+			std::unique_lock<std::mutex> lock{ mutex };
+			while (true) {
+				tasksReady.wait(lock, [this]() { return stopping || nextTaskIdx < tasksCount; });
+				if (stopping) {
+					return;
+				}
+				runAvailableTasks(lock);
+			}
+		}
+
+		// Called with the mutex locked, it is unlocked while a task runs
+		void runAvailableTasks(std::unique_lock<std::mutex>& lock)
+		{
+			while (nextTaskIdx < tasksCount) {
+				const int taskIdx{ nextTaskIdx++ };
+				void (*const currentCallTask)(void*, int) { callTask };
+				void* const currentTask{ task };
+				lock.unlock();
+				currentCallTask(currentTask, taskIdx);
+				lock.lock();
+				if (--unfinishedTasksCount == 0) {
+					tasksDone.notify_all();
+				}
+			}
+		}
+
+		std::mutex mutex;
+		std::condition_variable tasksReady;
+		std::condition_variable tasksDone;
+		std::vector<std::thread> workers;
+		bool stopping{ false };
+		bool busy{ false };
+
+		// Tasks of the current call, guarded by the mutex
+		void (*callTask)(void*, int) { nullptr };
+		void* task{ nullptr };
+		int tasksCount{ 0 };
+		int nextTaskIdx{ 0 };
+		int unfinishedTasksCount{ 0 };
+	};
+
+	ThreadPool& getThreadPool()
+	{
+		static ThreadPool threadPool;
+		return threadPool;
+	}
+}
+
+namespace Parallel
+{
+	namespace Impl
+	{
+		void runTasks(int tasksCount, void (*callTask)(void* task, int taskIdx), void* task)
+		{
+			if (!getThreadPool().run(tasksCount, callTask, task)) {
+				for (int taskIdx{ 0 }; taskIdx < tasksCount; ++taskIdx) {
+					callTask(task, taskIdx);
+				}
+			}
+		}
+	}
+}
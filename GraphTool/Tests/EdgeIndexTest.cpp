@@ -0,0 +1,65 @@
+#include "../3rdParty/doctest.h"
+#include "../Include/EdgeIndex.hpp"
+#include <map>
+#include <random>
+
+TEST_CASE("Edge Index") {
+	EdgeIndex<int> edgeIndex;
+	CHECK(edgeIndex.insert(1, 2, 5));
+	CHECK(edgeIndex.insert(2, 1, 7));
+
+	SUBCASE("Lookup") {
+		CHECK(edgeIndex.size() == 2);
+		CHECK(edgeIndex.contains(1, 2));
+		CHECK(edgeIndex.contains(2, 1));
+		CHECK_FALSE(edgeIndex.contains(1, 3));
+		CHECK(*edgeIndex.find(1, 2) == 5);
+		CHECK(*edgeIndex.find(2, 1) == 7);
+		CHECK(edgeIndex.find(3, 1) == nullptr);
+	}
+
+	SUBCASE("Insert existing edge") {
+		CHECK_FALSE(edgeIndex.insert(1, 2, 9));
+		CHECK(*edgeIndex.find(1, 2) == 5);
+		*edgeIndex.find(1, 2) = 9;
+		CHECK(*edgeIndex.find(1, 2) == 9);
+	}
+
+	SUBCASE("Erase") {
+		CHECK(edgeIndex.erase(1, 2));
+		CHECK_FALSE(edgeIndex.erase(1, 2));
+		CHECK_FALSE(edgeIndex.contains(1, 2));
+		CHECK(edgeIndex.contains(2, 1));
+		edgeIndex.clear();
+		CHECK(edgeIndex.empty());
+		CHECK_FALSE(edgeIndex.contains(2, 1));
+	}
+
+	SUBCASE("Matches std::map after random inserts and erases") {
+		std::map<std::pair<int, int>, int> expected{ { { 1, 2 }, 5 }, { { 2, 1 }, 7 } };
+		std::mt19937 generator{ 42 };
+		std::uniform_int_distribution<int> nodeDistribution{ 0, 60 };
+		for (int i{ 0 }; i < 5000; ++i) {
+			const int a{ nodeDistribution(generator) };
+			const int b{ nodeDistribution(generator) };
+			if (generator() % 3 == 0) {
+				CHECK(edgeIndex.erase(a, b) == (expected.erase({ a, b }) == 1));
+			}
+			else {
+				CHECK(edgeIndex.insert(a, b, i) == expected.insert({ { a, b }, i }).second);
+			}
+		}
+
+		CHECK(edgeIndex.size() == expected.size());
+		for (int a{ 0 }; a <= 60; ++a) {
+			for (int b{ 0 }; b <= 60; ++b) {
+				const auto it{ expected.find({ a, b }) };
+				const int* value{ edgeIndex.find(a, b) };
+				REQUIRE((it != expected.end()) == (value != nullptr));
+				if (value) {
+					CHECK(*value == it->second);
+				}
+			}
+		}
+	}
+}
@@ -1,5 +1,38 @@
 #include "../3rdParty/doctest.h"
 #include "../Include/GraphAlgorithms.hpp"
+#include "../Include/UnionFind.hpp"
+#include <random>
+
+namespace
+{
+	// Random graph with nodes [1, nodesCount], the generator is seeded the same way every time, so the graph is the same as well
+	void createRandomGraph(Graph& graph, int nodesCount, int edgesCount)
+	{
+		std::mt19937 generator{ 1 };
+		std::uniform_int_distribution<int> nodeDistribution{ 1, nodesCount };
+
+		graph.createNodes(nodesCount);
+		std::vector<Edge> edges;
+		edges.reserve(edgesCount);
+		for (int i{ 0 }; i < edgesCount; ++i) {
+			edges.push_back(Edge{ nodeDistribution(generator), nodeDistribution(generator) });
+		}
+		graph.addEdges(std::move(edges));
+	}
+
+	// Sets weights in range [minWeight, maxWeight] to the directed edges and separately to the undirected ones
+	void setRandomWeights(Graph& graph, int minWeight, int maxWeight)
+	{
+		std::mt19937 generator{ 1 };
+		std::uniform_int_distribution<int> weightDistribution{ minWeight, maxWeight };
+		for (const Edge& edge : graph.buildDirectedEdges()) {
+			graph.setEdgeWeight(edge.a, edge.b, weightDistribution(generator), Directed::Yes);
+		}
+		for (const Edge& edge : graph.buildUndirectedEdges()) {
+			graph.setEdgeWeight(edge.a, edge.b, weightDistribution(generator), Directed::No);
+		}
+	}
+}
 
 TEST_CASE("Graph Algorithms") {
 	Graph graph;
@@ -73,6 +106,12 @@ TEST_CASE("Graph Algorithms") {
 		CHECK(nodeOrder[5] == 6);
 	}
 
+	SUBCASE("Parallel BFS") {
+		const GraphAlgorithms::TraversalOrder traversalOrder{ GraphAlgorithms::bfs(graph, 1, ExecutionPolicy::Parallel) };
+		CHECK(traversalOrder.edgeOrder == std::vector<std::pair<int, int>>{ { 1, 2 }, { 2, 3 }, { 2, 5 }, { 3, 4 }, { 5, 6 } });
+		CHECK(traversalOrder.nodeOrder == std::vector<int>{ 1, 2, 3, 5, 4, 6 });
+	}
+
 	SUBCASE("Dijkstra") {
 		const GraphAlgorithms::TraversalOrder traversalOrder{ GraphAlgorithms::dijkstra(graph, 1, 6) };
 
@@ -95,6 +134,48 @@ TEST_CASE("Graph Algorithms") {
 		CHECK(nodeOrder[3] == 6);
 	}
 
+	SUBCASE("A*") {
+		// Path 1 - 2 - 5 - 6 goes straight to the right, 3 and 4 are above node 2
+		const std::map<int, std::pair<float, float>> positions{ { 1, { 0.f, 0.f } }, { 2, { 10.f, 0.f } }, { 3, { 10.f, 10.f } },
+			{ 4, { 10.f, 20.f } }, { 5, { 20.f, 0.f } }, { 6, { 30.f, 0.f } }, { 7, { 0.f, 30.f } }, { 8, { 10.f, 30.f } } };
+		const GraphAlgorithms::PositionLookup getPosition{ [&positions](int nodeId) { return positions.at(nodeId); } };
+		GraphAlgorithms::SearchStatistics aStarStatistics;
+		const GraphAlgorithms::TraversalOrder traversalOrder{ GraphAlgorithms::aStar(graph, 1, 6, getPosition, &aStarStatistics) };
+		GraphAlgorithms::SearchStatistics dijkstraStatistics;
+		CHECK(traversalOrder.edgeOrder == GraphAlgorithms::dijkstra(graph, 1, 6, GraphAlgorithms::ShortestPathQueue::Automatic, &dijkstraStatistics).edgeOrder);
+		CHECK(traversalOrder.nodeOrder == std::vector<int>{ 1, 2, 5, 6 });
+		CHECK(aStarStatistics.expandedNodesCount == 3);
+		CHECK(dijkstraStatistics.expandedNodesCount == 4);
+
+		CHECK(GraphAlgorithms::aStar(graph, 1, 7, getPosition).nodeOrder.empty());
+		CHECK(GraphAlgorithms::aStar(graph, 3, 3, getPosition).nodeOrder == std::vector<int>{ 3 });
+	}
+
+	SUBCASE("Eccentricities") {
+		GraphAlgorithms::DistancesSummary summary;
+		const auto [traversalOrder, nodesColorsIdxs] { GraphAlgorithms::eccentricities(graph, &summary) };
+		CHECK(summary.eccentricities == std::vector<long long>{ 3, 2, 3, 4, 3, 4, 1, 1 });
+		CHECK(summary.diameter == 4);
+		CHECK(summary.radius == 1);
+		CHECK(traversalOrder.nodeOrder.size() == 8);
+		checkNodesColorsIdxs(nodesColorsIdxs, 1, 0);
+		checkNodesColorsIdxs(nodesColorsIdxs, 4, 2);
+		checkNodesColorsIdxs(nodesColorsIdxs, 7, 3);
+	}
+
+	SUBCASE("Bidirectional Dijkstra") {
+		for (const bool directed : { false, true }) {
+			directed ? graph.makeDirected() : graph.makeUndirected();
+			const GraphAlgorithms::TraversalOrder traversalOrder{ GraphAlgorithms::bidirectionalDijkstra(graph, 1, 6) };
+			CHECK(traversalOrder.edgeOrder == GraphAlgorithms::dijkstra(graph, 1, 6).edgeOrder);
+			CHECK(traversalOrder.nodeOrder == std::vector<int>{ 1, 2, 5, 6 });
+		}
+
+		CHECK(GraphAlgorithms::bidirectionalDijkstra(graph, 6, 1).nodeOrder.empty());
+		CHECK(GraphAlgorithms::bidirectionalDijkstra(graph, 1, 7).nodeOrder.empty());
+		CHECK(GraphAlgorithms::bidirectionalDijkstra(graph, 3, 3).nodeOrder == std::vector<int>{ 3 });
+	}
+
 	SUBCASE("Coloring") {
 		const auto result { GraphAlgorithms::coloring(graph) };
 		const GraphAlgorithms::TraversalOrder traversalOrder{ result.first };
@@ -121,6 +202,32 @@ TEST_CASE("Graph Algorithms") {
 		checkNodesColorsIdxs(nodesColorsIdxs, 8, 1);
 	}
 
+	SUBCASE("Coloring strategies") {
+		// Isolated node is colored as well
+		const int isolatedNode{ graph.createNode() };
+		for (const auto strategy : { GraphAlgorithms::ColoringStrategy::Greedy, GraphAlgorithms::ColoringStrategy::SmallestLast,
+			GraphAlgorithms::ColoringStrategy::DSatur, GraphAlgorithms::ColoringStrategy::JonesPlassmann }) {
+			const auto [traversalOrder, nodesColorsIdxs] { GraphAlgorithms::coloring(graph, strategy) };
+			CHECK(traversalOrder.nodeOrder.size() == 9);
+			CHECK(nodesColorsIdxs.size() == 9);
+			checkNodesColorsIdxs(nodesColorsIdxs, isolatedNode, 0);
+			CHECK(GraphAlgorithms::isColoringValid(graph, nodesColorsIdxs));
+		}
+
+		GraphAlgorithms::NodesColorsIdxs nodesColorsIdxs{ GraphAlgorithms::coloring(graph).second };
+		nodesColorsIdxs[2] = nodesColorsIdxs[1];
+		CHECK_FALSE(GraphAlgorithms::isColoringValid(graph, nodesColorsIdxs));
+		nodesColorsIdxs[2].reset();
+		CHECK_FALSE(GraphAlgorithms::isColoringValid(graph, nodesColorsIdxs));
+		nodesColorsIdxs.erase(2);
+		CHECK_FALSE(GraphAlgorithms::isColoringValid(graph, nodesColorsIdxs));
+
+		// DSatur starts from the node with the biggest degree
+		CHECK(GraphAlgorithms::coloring(graph, GraphAlgorithms::ColoringStrategy::DSatur).first.nodeOrder.front() == 2);
+		// Node with the smallest degree is removed first, so it is colored last
+		CHECK(GraphAlgorithms::coloring(graph, GraphAlgorithms::ColoringStrategy::SmallestLast).first.nodeOrder.back() == isolatedNode);
+	}
+
 	SUBCASE("Islands") {
 		const auto result{ GraphAlgorithms::findIslands(graph) };
 		const GraphAlgorithms::TraversalOrder traversalOrder{ result.first };
@@ -177,6 +284,25 @@ TEST_CASE("Graph Algorithms") {
 		CHECK(nodeOrder[7] == 8);
 	}
 
+	SUBCASE("Prim") {
+		graph.makeWeighted();
+		graph.setEdgeWeight(1, 2, 5);
+		const GraphAlgorithms::TraversalOrder traversalOrder{ GraphAlgorithms::primMST(graph) };
+
+		// Edges are in the order in which they join the tree grown from node 1
+		const std::vector<std::pair<int, int>> expectedEdgeOrder{ { 1, 2 }, { 2, 3 }, { 2, 5 }, { 3, 4 }, { 5, 6 }, { 7, 8 } };
+		CHECK(traversalOrder.edgeOrder == expectedEdgeOrder);
+		CHECK(traversalOrder.nodeOrder == std::vector<int>{ 1, 2, 3, 5, 4, 6, 7, 8 });
+
+		// Edge pointing towards the tree is listed with its direction
+		graph.makeDirected();
+		graph.deleteEdge(3, 4);
+		graph.addEdge(4, 3);
+		const GraphAlgorithms::TraversalOrder directedTraversalOrder{ GraphAlgorithms::primMST(graph) };
+		CHECK(directedTraversalOrder.edgeOrder[3] == std::pair{ 4, 3 });
+		CHECK(directedTraversalOrder.nodeOrder == traversalOrder.nodeOrder);
+	}
+
 	SUBCASE("Degrees") {
 		const auto result{ GraphAlgorithms::nodesDegrees(graph) };
 		const GraphAlgorithms::NodesColorsIdxs nodesColorsIdxs{ result.second };
@@ -190,4 +316,455 @@ TEST_CASE("Graph Algorithms") {
 		checkNodesColorsIdxs(nodesColorsIdxs, 7, 0);
 		checkNodesColorsIdxs(nodesColorsIdxs, 8, 0);
 	}
-}
\ No newline at end of file
+}
+
+TEST_CASE("Graph Algorithms on long path") {
+	// Recursive traversal would overflow the call stack on such graph
+	const int nodesCount{ 200000 };
+	Graph graph;
+	graph.createNodes(nodesCount);
+	std::vector<Edge> edges;
+	for (int i{ 1 }; i < nodesCount; ++i) {
+		edges.push_back(Edge{ i, i + 1 });
+	}
+	graph.addEdges(std::move(edges));
+
+	SUBCASE("DFS") {
+		const GraphAlgorithms::TraversalOrder traversalOrder{ GraphAlgorithms::dfs(graph, 1) };
+		CHECK(traversalOrder.nodeOrder.size() == nodesCount);
+		CHECK(traversalOrder.edgeOrder.size() == nodesCount - 1);
+		CHECK(traversalOrder.nodeOrder.back() == nodesCount);
+	}
+
+	SUBCASE("Islands") {
+		const auto [traversalOrder, nodesColorsIdxs] { GraphAlgorithms::findIslands(graph) };
+		CHECK(traversalOrder.nodeOrder.size() == nodesCount);
+		CHECK(nodesColorsIdxs.at(nodesCount) == 0);
+	}
+}
+
+TEST_CASE("Parallel BFS on random graph") {
+	const int nodesCount{ 20000 };
+	Graph graph;
+	createRandomGraph(graph, nodesCount, nodesCount * 4);
+
+	// Levels of the nodes reached by the traversal, computed from the traversal edges
+	auto getLevels = [](const GraphAlgorithms::TraversalOrder& traversalOrder) {
+		std::map<int, int> levels{ { traversalOrder.nodeOrder.front(), 0 } };
+		for (const auto& [parent, node] : traversalOrder.edgeOrder) {
+			levels[node] = levels.at(parent) + 1;
+		}
+		return levels;
+	};
+
+	Parallel::setThreadsCount(4);
+	for (const bool directed : { false, true }) {
+		directed ? graph.makeDirected() : graph.makeUndirected();
+		const auto levels{ getLevels(GraphAlgorithms::bfs(graph, 1)) };
+		const GraphAlgorithms::TraversalOrder traversalOrder{ GraphAlgorithms::bfs(graph, 1, ExecutionPolicy::Parallel) };
+		CHECK(getLevels(traversalOrder) == levels);
+		CHECK(std::is_sorted(traversalOrder.nodeOrder.begin(), traversalOrder.nodeOrder.end(), [&levels](int a, int b) {
+			return std::pair{ levels.at(a), a } < std::pair{ levels.at(b), b };
+			}));
+		for (const auto& [parent, node] : traversalOrder.edgeOrder) {
+			CHECK(graph.doesEdgeExist(parent, node));
+		}
+	}
+	Parallel::setThreadsCount(0);
+}
+
+TEST_CASE("Connected components on random graph") {
+	const int nodesCount{ 20000 };
+
+	Parallel::setThreadsCount(4);
+	// Sparse graph has many small components, the denser one has a single large component
+	for (const int edgesCount : { nodesCount / 2, nodesCount * 2 }) {
+		Graph graph;
+		createRandomGraph(graph, nodesCount, edgesCount);
+
+		// Components numbered in the order of their smallest nodes
+		UnionFind trees{ nodesCount };
+		for (const Edge& edge : graph.buildUndirectedEdges()) {
+			trees.unite(edge.a - 1, edge.b - 1);
+		}
+		std::vector<int> expectedComponentsIdxs(nodesCount);
+		std::vector<int> rootsComponentsIdxs(nodesCount, -1);
+		int componentsCount{ 0 };
+		for (int node{ 0 }; node < nodesCount; ++node) {
+			int& componentIdx{ rootsComponentsIdxs[trees.find(node)] };
+			if (componentIdx == -1) {
+				componentIdx = componentsCount++;
+			}
+			expectedComponentsIdxs[node] = componentIdx;
+		}
+
+		// Directed edges are treated as undirected, so the components are the same
+		for (const bool directed : { false, true }) {
+			directed ? graph.makeDirected() : graph.makeUndirected();
+			for (const ExecutionPolicy executionPolicy : { ExecutionPolicy::Sequential, ExecutionPolicy::Parallel }) {
+				const GraphAlgorithms::ConnectedComponents components{ GraphAlgorithms::connectedComponents(graph, executionPolicy) };
+				CHECK(components.componentsCount == componentsCount);
+				CHECK(components.componentsIdxs == expectedComponentsIdxs);
+			}
+
+			// Graph overload uses the components maintained by the graph
+			const auto [traversalOrder, nodesColorsIdxs] { GraphAlgorithms::findIslands(graph) };
+			const auto [snapshotTraversalOrder, snapshotNodesColorsIdxs] { GraphAlgorithms::findIslands(*graph.snapshot()) };
+			CHECK(traversalOrder.nodeOrder.size() == nodesCount);
+			CHECK(traversalOrder.nodeOrder == snapshotTraversalOrder.nodeOrder);
+			CHECK(nodesColorsIdxs == snapshotNodesColorsIdxs);
+			CHECK(nodesColorsIdxs.at(nodesCount) == expectedComponentsIdxs[nodesCount - 1]);
+		}
+	}
+	Parallel::setThreadsCount(0);
+}
+
+TEST_CASE("Coloring on random graph") {
+	const int nodesCount{ 5000 };
+	Graph graph;
+	createRandomGraph(graph, nodesCount, nodesCount * 5);
+
+	auto getColorsCount = [](const GraphAlgorithms::NodesColorsIdxs& nodesColorsIdxs) {
+		int colorsCount{ 0 };
+		for (const auto& [nodeId, colorIdx] : nodesColorsIdxs) {
+			colorsCount = std::max(colorsCount, *colorIdx + 1);
+		}
+		return colorsCount;
+	};
+
+	std::map<GraphAlgorithms::ColoringStrategy, int> colorsCounts;
+	for (const bool directed : { false, true }) {
+		directed ? graph.makeDirected() : graph.makeUndirected();
+		for (const auto strategy : { GraphAlgorithms::ColoringStrategy::Greedy, GraphAlgorithms::ColoringStrategy::SmallestLast,
+			GraphAlgorithms::ColoringStrategy::DSatur, GraphAlgorithms::ColoringStrategy::JonesPlassmann }) {
+			const auto [traversalOrder, nodesColorsIdxs] { GraphAlgorithms::coloring(graph, strategy) };
+			CHECK(traversalOrder.nodeOrder.size() == nodesCount);
+			CHECK(nodesColorsIdxs.size() == nodesCount);
+
+			bool isColoringValid{ true };
+			for (const Edge& edge : graph.buildDirectedEdges()) {
+				isColoringValid &= edge.a == edge.b || nodesColorsIdxs.at(edge.a) != nodesColorsIdxs.at(edge.b);
+			}
+			CHECK(isColoringValid);
+			CHECK(GraphAlgorithms::isColoringValid(graph, nodesColorsIdxs));
+
+			// Directed edges are treated as undirected, so the result doesn't depend on the mode
+			const int colorsCount{ getColorsCount(nodesColorsIdxs) };
+			if (directed) {
+				CHECK(colorsCounts[strategy] == colorsCount);
+			}
+			colorsCounts[strategy] = colorsCount;
+		}
+	}
+	CHECK(colorsCounts[GraphAlgorithms::ColoringStrategy::SmallestLast] <= colorsCounts[GraphAlgorithms::ColoringStrategy::Greedy]);
+	CHECK(colorsCounts[GraphAlgorithms::ColoringStrategy::DSatur] <= colorsCounts[GraphAlgorithms::ColoringStrategy::Greedy]);
+
+	SUBCASE("Jones-Plassmann threads") {
+		// Priorities don't depend on the threads, so neither does the result
+		Parallel::setThreadsCount(1);
+		const auto sequentialResult{ GraphAlgorithms::coloring(graph, GraphAlgorithms::ColoringStrategy::JonesPlassmann) };
+		Parallel::setThreadsCount(4);
+		const auto parallelResult{ GraphAlgorithms::coloring(graph, GraphAlgorithms::ColoringStrategy::JonesPlassmann) };
+		Parallel::setThreadsCount(0);
+		CHECK(parallelResult.first.nodeOrder == sequentialResult.first.nodeOrder);
+		CHECK(parallelResult.second == sequentialResult.second);
+	}
+
+	SUBCASE("Crown graph") {
+		// Nodes a_i and b_j are connected if i != j, greedy coloring in the order a_1, b_1, a_2, b_2, ... needs a color for every pair
+		const int pairsCount{ 10 };
+		Graph crownGraph;
+		crownGraph.createNodes(pairsCount * 2);
+		for (int i{ 0 }; i < pairsCount; ++i) {
+			for (int j{ 0 }; j < pairsCount; ++j) {
+				if (i != j) {
+					crownGraph.addEdge(i * 2 + 1, j * 2 + 2);
+				}
+			}
+		}
+
+		CHECK(getColorsCount(GraphAlgorithms::coloring(crownGraph, GraphAlgorithms::ColoringStrategy::Greedy).second) == pairsCount);
+		CHECK(getColorsCount(GraphAlgorithms::coloring(crownGraph, GraphAlgorithms::ColoringStrategy::DSatur).second) == 2);
+	}
+}
+
+TEST_CASE("Dijkstra on random graph") {
+	const int nodesCount{ 2000 };
+	Graph graph;
+	createRandomGraph(graph, nodesCount, nodesCount * 4);
+	graph.makeWeighted();
+	// Edges with 0 weight are included on purpose, they add nodes to the bucket being popped
+	setRandomWeights(graph, 0, 20);
+
+	auto getPathLength = [&graph](const GraphAlgorithms::TraversalOrder& traversalOrder) {
+		int length{ 0 };
+		// The first edge is (startNode, startNode)
+		for (std::size_t i{ 1 }; i < traversalOrder.edgeOrder.size(); ++i) {
+			CHECK(graph.doesEdgeExist(traversalOrder.edgeOrder[i].first, traversalOrder.edgeOrder[i].second));
+			length += graph.getEdgeWeight(traversalOrder.edgeOrder[i].first, traversalOrder.edgeOrder[i].second);
+		}
+		return length;
+	};
+
+	// Positions not related to the weights, the heuristic has to be scaled down to keep the paths shortest
+	std::mt19937 generator{ 1 };
+	std::uniform_real_distribution<float> positionDistribution{ 0.f, 1000.f };
+	std::map<int, std::pair<float, float>> positions;
+	for (int node{ 1 }; node <= nodesCount; ++node) {
+		positions[node] = { positionDistribution(generator), positionDistribution(generator) };
+	}
+	const GraphAlgorithms::PositionLookup getPosition{ [&positions](int nodeId) { return positions.at(nodeId); } };
+
+	for (const bool directed : { false, true }) {
+		directed ? graph.makeDirected() : graph.makeUndirected();
+		for (int endNode{ 1 }; endNode <= nodesCount; endNode += 97) {
+			const GraphAlgorithms::TraversalOrder heapResult{ GraphAlgorithms::dijkstra(graph, 1, endNode, GraphAlgorithms::ShortestPathQueue::BinaryHeap) };
+			const GraphAlgorithms::TraversalOrder bucketResult{ GraphAlgorithms::dijkstra(graph, 1, endNode, GraphAlgorithms::ShortestPathQueue::BucketQueue) };
+			CHECK(heapResult.edgeOrder == bucketResult.edgeOrder);
+			CHECK(heapResult.nodeOrder == bucketResult.nodeOrder);
+
+			// There can be several shortest paths, so only the lengths are compared
+			const GraphAlgorithms::TraversalOrder bidirectionalResult{ GraphAlgorithms::bidirectionalDijkstra(graph, 1, endNode) };
+			CHECK(bidirectionalResult.nodeOrder.empty() == heapResult.nodeOrder.empty());
+			CHECK(getPathLength(bidirectionalResult) == getPathLength(heapResult));
+			if (!bidirectionalResult.nodeOrder.empty()) {
+				CHECK(bidirectionalResult.nodeOrder.back() == endNode);
+			}
+
+			const GraphAlgorithms::TraversalOrder aStarResult{ GraphAlgorithms::aStar(graph, 1, endNode, getPosition) };
+			CHECK(aStarResult.nodeOrder.empty() == heapResult.nodeOrder.empty());
+			CHECK(getPathLength(aStarResult) == getPathLength(heapResult));
+		}
+	}
+
+	// Bucket queue would need a bucket for every weight, the binary heap is used instead
+	const Edge heavyEdge{ graph.buildDirectedEdges().front() };
+	graph.setEdgeWeight(heavyEdge.a, heavyEdge.b, 2000000000);
+	const GraphAlgorithms::TraversalOrder heapResult{ GraphAlgorithms::dijkstra(graph, heavyEdge.a, heavyEdge.b, GraphAlgorithms::ShortestPathQueue::BinaryHeap) };
+	const GraphAlgorithms::TraversalOrder bucketResult{ GraphAlgorithms::dijkstra(graph, heavyEdge.a, heavyEdge.b, GraphAlgorithms::ShortestPathQueue::BucketQueue) };
+	CHECK(bucketResult.edgeOrder == heapResult.edgeOrder);
+}
+
+TEST_CASE("Shortest paths on random graph") {
+	const int nodesCount{ 5000 };
+	Graph graph;
+	createRandomGraph(graph, nodesCount, nodesCount * 4);
+	graph.makeWeighted();
+	setRandomWeights(graph, 0, 50);
+
+	// Every predecessor has to be the last step of a shortest path and following them has to lead to the start node
+	auto checkPredecessors = [](const Graph& graph, const GraphSnapshot& snapshot, const GraphAlgorithms::ShortestPaths& shortestPaths, int startNode) {
+		const int startNodeIdx{ snapshot.getNodeIdx(startNode) };
+		CHECK(shortestPaths.predecessors[startNodeIdx] == -1);
+		bool arePredecessorsValid{ true };
+		bool doPathsReachStart{ true };
+		for (int node{ 0 }; node < snapshot.getNodesCount(); ++node) {
+			const int predecessor{ shortestPaths.predecessors[node] };
+			if (predecessor != -1) {
+				const int weight{ graph.getEdgeWeight(snapshot.getNodeId(predecessor), snapshot.getNodeId(node)) };
+				arePredecessorsValid &= shortestPaths.distances[predecessor] + weight == shortestPaths.distances[node];
+			}
+			if (shortestPaths.distances[node] == std::numeric_limits<int>::max()) {
+				continue;
+			}
+
+			int pathNode{ node };
+			for (int steps{ 0 }; pathNode != -1 && pathNode != startNodeIdx && steps < snapshot.getNodesCount(); ++steps) {
+				pathNode = shortestPaths.predecessors[pathNode];
+			}
+			doPathsReachStart &= pathNode == startNodeIdx;
+		}
+		CHECK(arePredecessorsValid);
+		CHECK(doPathsReachStart);
+	};
+
+	auto compareWithSequential = [&checkPredecessors](const Graph& graph, int startNode, std::initializer_list<int> deltas) {
+		const auto snapshot{ graph.snapshot() };
+		const GraphAlgorithms::ShortestPaths sequentialResult{ GraphAlgorithms::shortestPaths(*snapshot, startNode) };
+		checkPredecessors(graph, *snapshot, sequentialResult, startNode);
+		for (const int delta : deltas) {
+			const GraphAlgorithms::ShortestPaths parallelResult{ GraphAlgorithms::shortestPaths(*snapshot, startNode, ExecutionPolicy::Parallel, delta) };
+			CHECK(parallelResult.distances == sequentialResult.distances);
+			checkPredecessors(graph, *snapshot, parallelResult, startNode);
+		}
+	};
+
+	Parallel::setThreadsCount(4);
+	for (const bool directed : { false, true }) {
+		directed ? graph.makeDirected() : graph.makeUndirected();
+		for (const bool weighted : { true, false }) {
+			weighted ? graph.makeWeighted() : graph.makeUnweighted();
+			compareWithSequential(graph, 1, { 0, 1, 7, 100 });
+		}
+	}
+
+	SUBCASE("Zero weights") {
+		// Nodes with equal distances are connected by zero weight edges, predecessors among them could make a cycle
+		graph.makeWeighted();
+		for (const int maxWeight : { 0, 1 }) {
+			setRandomWeights(graph, 0, maxWeight);
+			for (const bool directed : { false, true }) {
+				directed ? graph.makeDirected() : graph.makeUndirected();
+				compareWithSequential(graph, 1, { 0, 1, 7 });
+			}
+		}
+
+		Graph triangleGraph;
+		triangleGraph.createNodes(3);
+		triangleGraph.makeWeighted();
+		triangleGraph.addEdges({ Edge{ 3, 1 }, Edge{ 3, 2 }, Edge{ 1, 2 } });
+		compareWithSequential(triangleGraph, 3, { 1 });
+	}
+	Parallel::setThreadsCount(0);
+
+	SUBCASE("Heavy edge") {
+		// Delta of 1 would need a bucket for every distance up to the weight
+		Graph heavyGraph;
+		heavyGraph.createNodes(3);
+		heavyGraph.makeWeighted();
+		heavyGraph.addEdges({ Edge{ 1, 2 }, Edge{ 2, 3 } });
+		heavyGraph.setEdgeWeight(1, 2, 2000000000);
+		heavyGraph.setEdgeWeight(2, 3, 1);
+		const GraphAlgorithms::ShortestPaths parallelResult{ GraphAlgorithms::shortestPaths(heavyGraph, 1, ExecutionPolicy::Parallel, 1) };
+		CHECK(parallelResult.distances == std::vector<int>{ 0, 2000000000, 2000000001 });
+	}
+}
+
+TEST_CASE("All pairs shortest paths on random graph") {
+	// Not a multiple of the tile size, so the matrix is padded
+	const int nodesCount{ 150 };
+	Graph graph;
+	createRandomGraph(graph, nodesCount, nodesCount * 2);
+	graph.makeWeighted();
+	setRandomWeights(graph, 0, 50);
+
+	Parallel::setThreadsCount(4);
+	for (const bool directed : { false, true }) {
+		directed ? graph.makeDirected() : graph.makeUndirected();
+		const auto snapshot{ graph.snapshot() };
+		const GraphAlgorithms::DistanceMatrix sequentialResult{ GraphAlgorithms::allPairsShortestPaths(*snapshot) };
+		const GraphAlgorithms::DistanceMatrix parallelResult{ GraphAlgorithms::allPairsShortestPaths(*snapshot, ExecutionPolicy::Parallel) };
+		CHECK(sequentialResult.nodesCount == nodesCount);
+		// Paths of the random graph are short enough for 32-bit distances
+		CHECK(sequentialResult.hasIntDistances());
+		CHECK(parallelResult.intDistances == sequentialResult.intDistances);
+
+		for (int from{ 0 }; from < nodesCount; ++from) {
+			const GraphAlgorithms::ShortestPaths shortestPaths{ GraphAlgorithms::shortestPaths(*snapshot, snapshot->getNodeId(from)) };
+			for (int to{ 0 }; to < nodesCount; ++to) {
+				const long long distance{ shortestPaths.distances[to] == std::numeric_limits<int>::max() ? GraphAlgorithms::DistanceMatrix::unreachable : shortestPaths.distances[to] };
+				CHECK(sequentialResult.getDistance(from, to) == distance);
+			}
+		}
+		CHECK(!sequentialResult.hasNegativeCycle);
+	}
+	Parallel::setThreadsCount(0);
+}
+
+TEST_CASE("All pairs shortest paths with extreme weights") {
+	Graph graph;
+	graph.createNodes(4);
+	graph.makeDirected();
+	graph.makeWeighted();
+	graph.addEdges({ Edge{ 1, 2 }, Edge{ 2, 3 }, Edge{ 3, 4 } });
+	const int maxWeight{ std::numeric_limits<int>::max() };
+
+	SUBCASE("Long paths") {
+		// Weights and their sums are larger than any 32-bit sentinel
+		graph.setEdgeWeight(1, 2, maxWeight);
+		graph.setEdgeWeight(2, 3, maxWeight);
+		graph.setEdgeWeight(3, 4, maxWeight);
+		const GraphAlgorithms::DistanceMatrix distanceMatrix{ GraphAlgorithms::allPairsShortestPaths(graph) };
+		CHECK(distanceMatrix.getDistance(0, 1) == maxWeight);
+		CHECK(distanceMatrix.getDistance(0, 3) == 3LL * maxWeight);
+		CHECK(distanceMatrix.getDistance(3, 0) == GraphAlgorithms::DistanceMatrix::unreachable);
+		CHECK(!distanceMatrix.hasIntDistances());
+		CHECK(!distanceMatrix.hasNegativeCycle);
+	}
+
+	SUBCASE("Negative weights") {
+		graph.setEdgeWeight(1, 2, -maxWeight);
+		graph.setEdgeWeight(2, 3, -maxWeight);
+		graph.setEdgeWeight(3, 4, 1);
+		const GraphAlgorithms::DistanceMatrix distanceMatrix{ GraphAlgorithms::allPairsShortestPaths(graph) };
+		CHECK(distanceMatrix.getDistance(0, 3) == -2LL * maxWeight + 1);
+		CHECK(distanceMatrix.getDistance(1, 0) == GraphAlgorithms::DistanceMatrix::unreachable);
+		CHECK(!distanceMatrix.hasNegativeCycle);
+	}
+
+	SUBCASE("Negative cycle") {
+		graph.addEdges({ Edge{ 4, 1 } });
+		graph.setEdgeWeight(1, 2, 1);
+		graph.setEdgeWeight(2, 3, 1);
+		graph.setEdgeWeight(3, 4, 1);
+		graph.setEdgeWeight(4, 1, -maxWeight);
+		const GraphAlgorithms::DistanceMatrix distanceMatrix{ GraphAlgorithms::allPairsShortestPaths(graph) };
+		CHECK(distanceMatrix.hasNegativeCycle);
+
+		GraphAlgorithms::DistancesSummary summary;
+		GraphAlgorithms::eccentricities(graph, &summary);
+		CHECK(summary.hasNegativeCycle);
+	}
+}
+
+TEST_CASE("Minimum spanning trees on random graph") {
+	const int nodesCount{ 5000 };
+	Graph graph;
+	createRandomGraph(graph, nodesCount, nodesCount * 2);
+
+	auto getTreeWeight = [&graph](const GraphAlgorithms::TraversalOrder& traversalOrder) {
+		long long weight{ 0 };
+		for (const auto& [a, b] : traversalOrder.edgeOrder) {
+			weight += graph.getEdgeWeight(a, b);
+		}
+		return weight;
+	};
+
+	Parallel::setThreadsCount(4);
+	// Small weights are sorted with counting sort, the wide range with comparison sort
+	for (const auto& [minWeight, maxWeight] : { std::pair{ 0, 99 }, std::pair{ -1000000, 1000000 } }) {
+		setRandomWeights(graph, minWeight, maxWeight);
+		for (const bool directed : { false, true }) {
+			directed ? graph.makeDirected() : graph.makeUndirected();
+			for (const bool weighted : { true, false }) {
+				weighted ? graph.makeWeighted() : graph.makeUnweighted();
+				const GraphAlgorithms::TraversalOrder kruskalResult{ GraphAlgorithms::kruskalMST(graph) };
+				const GraphAlgorithms::TraversalOrder boruvkaResult{ GraphAlgorithms::boruvkaMST(graph) };
+				CHECK(boruvkaResult.edgeOrder == kruskalResult.edgeOrder);
+				CHECK(boruvkaResult.nodeOrder == kruskalResult.nodeOrder);
+				CHECK(getTreeWeight(boruvkaResult) == getTreeWeight(kruskalResult));
+				CHECK(std::is_sorted(kruskalResult.edgeOrder.begin(), kruskalResult.edgeOrder.end(), [&graph](const auto& edge1, const auto& edge2) {
+					return graph.getEdgeWeight(edge1.first, edge1.second) < graph.getEdgeWeight(edge2.first, edge2.second);
+					}));
+
+				// Prim's algorithm chooses the same edges, only in a different order
+				GraphAlgorithms::TraversalOrder primResult{ GraphAlgorithms::primMST(graph) };
+				CHECK(getTreeWeight(primResult) == getTreeWeight(kruskalResult));
+				std::sort(primResult.edgeOrder.begin(), primResult.edgeOrder.end());
+				std::vector<std::pair<int, int>> kruskalEdges{ kruskalResult.edgeOrder };
+				std::sort(kruskalEdges.begin(), kruskalEdges.end());
+				CHECK(primResult.edgeOrder == kruskalEdges);
+			}
+		}
+	}
+	Parallel::setThreadsCount(0);
+}
+
+TEST_CASE("Minimum spanning tree on dense graph") {
+	const int nodesCount{ 200 };
+	Graph graph;
+	createRandomGraph(graph, nodesCount, nodesCount * 32);
+	graph.makeWeighted();
+	setRandomWeights(graph, -1000000, 1000000);
+
+	// Dense graph with a wide range of weights, where Prim's algorithm is the faster one
+	GraphAlgorithms::TraversalOrder kruskalResult{ GraphAlgorithms::kruskalMST(graph) };
+	GraphAlgorithms::TraversalOrder primResult{ GraphAlgorithms::primMST(graph) };
+	GraphAlgorithms::TraversalOrder boruvkaResult{ GraphAlgorithms::boruvkaMST(graph) };
+	CHECK(kruskalResult.edgeOrder.size() == nodesCount - 1);
+	CHECK(boruvkaResult.edgeOrder == kruskalResult.edgeOrder);
+
+	std::sort(kruskalResult.edgeOrder.begin(), kruskalResult.edgeOrder.end());
+	std::sort(primResult.edgeOrder.begin(), primResult.edgeOrder.end());
+	CHECK(primResult.edgeOrder == kruskalResult.edgeOrder);
+}
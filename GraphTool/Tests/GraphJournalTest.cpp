@@ -0,0 +1,40 @@
+#include "../3rdParty/doctest.h"
+#include "../Include/GraphJournal.hpp"
+
+TEST_CASE("Graph Journal") {
+	GraphJournal journal;
+	journal.record(GraphChange::Type::NodeCreated, 1);
+	CHECK(journal.getVersion() == 1);
+	CHECK_FALSE(journal.getChangesSince(0).has_value()); // journal disabled
+
+	journal.setCapacity(3);
+	journal.record(GraphChange::Type::NodeCreated, 2);
+	journal.record(GraphChange::Type::DirectedEdgeAdded, 1, 2, 5);
+
+	SUBCASE("Changes since version") {
+		CHECK(journal.getVersion() == 3);
+		CHECK(journal.getChangesSince(3)->empty());
+		CHECK_FALSE(journal.getChangesSince(0).has_value());
+
+		const auto changes{ journal.getChangesSince(1) };
+		REQUIRE(changes.has_value());
+		REQUIRE(changes->size() == 2);
+		CHECK(changes->at(0).type == GraphChange::Type::NodeCreated);
+		CHECK(changes->at(0).version == 2);
+		CHECK(changes->at(1).type == GraphChange::Type::DirectedEdgeAdded);
+		CHECK(changes->at(1).a == 1);
+		CHECK(changes->at(1).b == 2);
+		CHECK(changes->at(1).weight == 5);
+	}
+
+	SUBCASE("Oldest changes are dropped") {
+		journal.record(GraphChange::Type::NodeDeleted, 2);
+		journal.record(GraphChange::Type::NodeDeleted, 1);
+		CHECK_FALSE(journal.getChangesSince(1).has_value());
+		CHECK(journal.getChangesSince(2)->size() == 3);
+
+		journal.setCapacity(1);
+		CHECK_FALSE(journal.getChangesSince(3).has_value());
+		CHECK(journal.getChangesSince(4)->front().type == GraphChange::Type::NodeDeleted);
+	}
+}
@@ -0,0 +1,109 @@
+#include "../3rdParty/doctest.h"
+#include "../Include/GraphSnapshot.hpp"
+#include "../Include/Graph.hpp"
+
+TEST_CASE("Graph Snapshot") {
+	Graph graph;
+	for (int i{ 0 }; i < 5; ++i) {
+		graph.createNode();
+	}
+	graph.addEdge(3, 1);
+	graph.addEdge(1, 5);
+	graph.addEdge(5, 3);
+	graph.setEdgeWeight(1, 5, 7);
+	graph.deleteNode(2);
+
+	auto getNeighborsIds = [](const GraphSnapshot& snapshot, int nodeId) {
+		std::vector<int> result;
+		const int nodeIdx{ snapshot.getNodeIdx(nodeId) };
+		for (int i{ snapshot.getOffsets()[nodeIdx] }; i < snapshot.getOffsets()[nodeIdx + 1]; ++i) {
+			result.push_back(snapshot.getNodeId(snapshot.getNeighbors()[i]));
+		}
+		return result;
+	};
+
+	SUBCASE("Dense indices") {
+		const GraphSnapshot snapshot{ *graph.snapshot() };
+		CHECK(snapshot.getNodesCount() == 4);
+		CHECK(snapshot.getNodeIdx(1) == 0);
+		CHECK(snapshot.getNodeIdx(2) == -1);
+		CHECK(snapshot.getNodeIdx(3) == 1);
+		CHECK(snapshot.getNodeIdx(5) == 3);
+		CHECK(snapshot.getNodeIdx(6) == -1);
+		CHECK(snapshot.getNodeId(2) == 4);
+	}
+
+	SUBCASE("Sparse ids") {
+		graph.setNextNodeId(1000000);
+		const int farNodeId{ graph.createNode() };
+		graph.addEdge(1, farNodeId);
+		const GraphSnapshot snapshot{ *graph.snapshot() };
+		CHECK(snapshot.getNodeIdx(1) == 0);
+		CHECK(snapshot.getNodeIdx(2) == -1);
+		CHECK(snapshot.getNodeIdx(farNodeId) == 4);
+		CHECK(snapshot.getNodeIdx(farNodeId - 1) == -1);
+		CHECK(snapshot.getNodeIdx(farNodeId + 1) == -1);
+		CHECK(getNeighborsIds(snapshot, 1) == std::vector<int>{ 3, 5, farNodeId });
+	}
+
+	SUBCASE("Undirected rows") {
+		const GraphSnapshot snapshot{ *graph.snapshot() };
+		CHECK(snapshot.getEdgesCount() == 3);
+		CHECK(getNeighborsIds(snapshot, 1) == std::vector<int>{ 3, 5 });
+		CHECK(getNeighborsIds(snapshot, 3) == std::vector<int>{ 1, 5 });
+		CHECK(getNeighborsIds(snapshot, 4).empty());
+		CHECK(getNeighborsIds(snapshot, 5) == std::vector<int>{ 1, 3 });
+	}
+
+	SUBCASE("Directed rows") {
+		graph.makeDirected();
+		const GraphSnapshot snapshot{ *graph.snapshot() };
+		CHECK(snapshot.getEdgesCount() == 3);
+		CHECK(getNeighborsIds(snapshot, 1) == std::vector<int>{ 5 });
+		CHECK(getNeighborsIds(snapshot, 3) == std::vector<int>{ 1 });
+		CHECK(getNeighborsIds(snapshot, 5) == std::vector<int>{ 3 });
+	}
+
+	SUBCASE("Incoming rows") {
+		graph.addEdge(1, 3);
+		graph.makeDirected();
+		graph.makeWeighted();
+		graph.setEdgeWeight(1, 3, 4);
+		const GraphSnapshot snapshot{ *graph.snapshot() };
+		const int nodeIdx{ snapshot.getNodeIdx(3) };
+		CHECK(snapshot.getInDegree(nodeIdx) == 2);
+		CHECK(snapshot.getInDegree(snapshot.getNodeIdx(4)) == 0);
+		CHECK(snapshot.getNodeId(snapshot.getInNeighbors()[snapshot.getInOffsets()[nodeIdx]]) == 1);
+		CHECK(snapshot.getInWeights()[snapshot.getInOffsets()[nodeIdx]] == 4);
+		CHECK(snapshot.getNodeId(snapshot.getInNeighbors()[snapshot.getInOffsets()[nodeIdx] + 1]) == 5);
+
+		graph.makeUndirected();
+		const GraphSnapshot undirectedSnapshot{ *graph.snapshot() };
+		CHECK(&undirectedSnapshot.getInNeighbors() == &undirectedSnapshot.getNeighbors());
+	}
+
+	SUBCASE("Versions") {
+		const auto snapshot{ graph.snapshot() };
+		CHECK(snapshot->getVersion() == graph.version());
+		CHECK(graph.snapshot().get() == snapshot.get());
+
+		graph.addEdge(1, 4);
+		const auto newSnapshot{ graph.snapshot() };
+		CHECK(newSnapshot.get() != snapshot.get());
+		CHECK(newSnapshot->getVersion() == graph.version());
+		CHECK(newSnapshot->getEdgesCount() == 4);
+		CHECK(snapshot->getEdgesCount() == 3);
+	}
+
+	SUBCASE("Weights") {
+		CHECK(graph.snapshot()->getWeights()[0] == 1); // not weighted
+		CHECK(graph.snapshot()->getMaxWeight() == 1);
+		graph.makeWeighted();
+		const GraphSnapshot snapshot{ *graph.snapshot() };
+		const int nodeIdx{ snapshot.getNodeIdx(1) };
+		CHECK(snapshot.getWeights()[snapshot.getOffsets()[nodeIdx]] == graph.getEdgeWeight(1, 3));
+		CHECK(snapshot.getWeights()[snapshot.getOffsets()[nodeIdx] + 1] == 7);
+		CHECK(snapshot.getMinWeight() == graph.getEdgeWeight(1, 3));
+		CHECK(snapshot.getMaxWeight() == 7);
+	}
+}
@@ -1,5 +1,7 @@
 #include "../3rdParty/doctest.h"
 #include "../Include/Graph.hpp"
+#include "../Include/GraphAlgorithms.hpp"
+#include <random>
 
 TEST_CASE("Node") {
 	Node node1{ 1 };
@@ -47,6 +49,28 @@ TEST_CASE("Graph") {
 		CHECK_FALSE(graph.doesEdgeExist(nodeA, nodeB));
 	}
 
+	SUBCASE("Deleting node should report deleted edges") {
+		struct DeletedEdges
+		{
+			void onDirectedEdgesDeleted(std::vector<std::pair<int, int>> edges) { directedEdges = std::move(edges); }
+			void onUndirectedEdgesDeleted(std::vector<std::pair<int, int>> edges) { undirectedEdges = std::move(edges); }
+
+			std::vector<std::pair<int, int>> directedEdges;
+			std::vector<std::pair<int, int>> undirectedEdges;
+		} deletedEdges;
+		graph.onDirectedEdgesDeleted.connect("Test", &deletedEdges, &DeletedEdges::onDirectedEdgesDeleted);
+		graph.onUndirectedEdgesDeleted.connect("Test", &deletedEdges, &DeletedEdges::onUndirectedEdgesDeleted);
+
+		const int nodeC{ graph.createNode() };
+		graph.addEdge(nodeB, nodeA);
+		graph.addEdge(nodeC, nodeB);
+		graph.deleteNode(nodeB);
+		CHECK(deletedEdges.directedEdges == std::vector<std::pair<int, int>>{ { nodeA, nodeB }, { nodeB, nodeA }, { nodeC, nodeB } });
+		CHECK(deletedEdges.undirectedEdges == std::vector<std::pair<int, int>>{ { nodeA, nodeB }, { nodeB, nodeC } });
+		CHECK(graph.buildDirectedEdges().empty());
+		CHECK(graph.buildAdjacencyList().at(nodeC).empty());
+	}
+
 	SUBCASE("Directed/undirected edges") {
 		CHECK(graph.doesEdgeExist(nodeA, nodeB));
 		CHECK(graph.doesEdgeExist(nodeB, nodeA));
@@ -59,11 +83,78 @@ TEST_CASE("Graph") {
 
 	SUBCASE("Edges/nodes container size") {
 		CHECK(graph.getNodes().size() == 2);
-		CHECK(graph.getEdges().size() == 1);
+		CHECK(graph.buildEdges().size() == 1);
 		graph.addEdge(nodeB, nodeA);
-		CHECK(graph.getEdges().size() == 1);
+		CHECK(graph.buildEdges().size() == 1);
 		graph.makeDirected();
-		CHECK(graph.getEdges().size() == 2);
+		CHECK(graph.buildEdges().size() == 2);
+	}
+
+	SUBCASE("Undirected edges are derived from directed edges") {
+		graph.makeWeighted();
+		graph.addEdge(nodeB, nodeA);
+		graph.setEdgeWeight(nodeA, nodeB, 3, Directed::Yes);
+		graph.setEdgeWeight(nodeB, nodeA, 4, Directed::Yes);
+		graph.setEdgeWeight(nodeB, nodeA, 7, Directed::No);
+		CHECK(graph.buildUndirectedEdges() == std::vector<Edge>{ { nodeA, nodeB } });
+		CHECK(graph.getEdgeWeight(nodeB, nodeA) == 7);
+		graph.makeDirected();
+		CHECK(graph.getEdgeWeight(nodeB, nodeA) == 4);
+
+		graph.deleteEdge(nodeA, nodeB);
+		CHECK_FALSE(graph.doesEdgeExist(nodeA, nodeB));
+		graph.makeUndirected();
+		CHECK(graph.doesEdgeExist(nodeA, nodeB));
+		CHECK(graph.getEdgeWeight(nodeA, nodeB) == 7);
+
+		graph.deleteEdge(nodeA, nodeB);
+		graph.addEdge(nodeA, nodeB);
+		CHECK(graph.getEdgeWeight(nodeA, nodeB) == 0);
+	}
+
+	SUBCASE("In/out neighbors") {
+		const int nodeC{ graph.createNode() };
+		graph.addEdge(nodeC, nodeB);
+		CHECK(graph.getInNeighbors(nodeB) == std::pmr::set<int>{ nodeA, nodeC });
+		CHECK(graph.getOutNeighbors(nodeB).empty());
+		CHECK(graph.getOutNeighbors(nodeC) == std::pmr::set<int>{ nodeB });
+		graph.deleteEdge(nodeA, nodeB);
+		CHECK(graph.getInNeighbors(nodeB) == std::pmr::set<int>{ nodeC });
+		graph.deleteNode(nodeC);
+		CHECK(graph.getInNeighbors(nodeB).empty());
+		CHECK(graph.getInNeighbors(100).empty());
+	}
+
+	SUBCASE("Version and journal") {
+		graph.setJournalCapacity(16);
+		const std::uint64_t version{ graph.version() };
+		graph.addEdge(nodeA, nodeB);
+		graph.makeUndirected();
+		CHECK(graph.version() == version); // nothing changed
+
+		const int nodeC{ graph.createNode() };
+		graph.addEdge(nodeC, nodeA);
+		graph.makeWeighted();
+		graph.setEdgeWeight(nodeC, nodeA, 4);
+		graph.deleteNode(nodeC);
+		CHECK(graph.version() == version + 6);
+
+		const auto changes{ graph.getChangesSince(version) };
+		REQUIRE(changes.has_value());
+		std::vector<GraphChange::Type> types;
+		for (const GraphChange& change : *changes) {
+			types.push_back(change.type);
+		}
+		CHECK(types == std::vector<GraphChange::Type>{ GraphChange::Type::NodeCreated, GraphChange::Type::DirectedEdgeAdded, GraphChange::Type::WeightedModeChanged,
+			GraphChange::Type::UndirectedWeightChanged, GraphChange::Type::DirectedEdgeDeleted, GraphChange::Type::NodeDeleted });
+		CHECK(changes->at(3).a == nodeA);
+		CHECK(changes->at(3).b == nodeC);
+		CHECK(changes->at(3).weight == 4);
+		CHECK(changes->back().a == nodeC);
+
+		graph.reset();
+		CHECK(graph.version() == version + 7);
+		CHECK(graph.getChangesSince(version + 6)->front().type == GraphChange::Type::Cleared);
 	}
 
 	SUBCASE("Modify next node id") {
@@ -80,15 +171,151 @@ TEST_CASE("Graph") {
 		CHECK(graph.getEdgeWeight(nodeA, nodeB) == 5);
 	}
 
+	SUBCASE("Bulk construction") {
+		const int firstNodeId{ graph.createNodes(6) };
+		CHECK(firstNodeId == 3);
+		CHECK(graph.getNodes().size() == 8);
+
+		Graph expectedGraph;
+		expectedGraph.createNodes(8);
+		expectedGraph.addEdge(nodeA, nodeB);
+
+		std::vector<Edge> edges{ { 3, 4, 2 }, { 8, 1, 5 }, { 4, 3, 1 }, { 3, 4, 7 }, { 2, 1 }, { 5, 9 }, { 6, 7, 3 } };
+		for (const Edge& edge : edges) {
+			if (!expectedGraph.doesDirectedEdgeExist(edge.a, edge.b)) {
+				expectedGraph.addEdge(edge.a, edge.b);
+				expectedGraph.setEdgeWeight(edge.a, edge.b, edge.weight, Directed::Yes);
+			}
+		}
+		graph.addEdges(edges);
+
+		auto checkSameEdges = [](const std::vector<Edge>& edges, const std::vector<Edge>& expectedEdges) {
+			REQUIRE(edges.size() == expectedEdges.size());
+			for (auto it{ edges.begin() }, expectedIt{ expectedEdges.begin() }; it != edges.end(); ++it, ++expectedIt) {
+				CHECK(*it == *expectedIt);
+				CHECK(it->weight == expectedIt->weight);
+			}
+		};
+		checkSameEdges(graph.buildDirectedEdges(), expectedGraph.buildDirectedEdges());
+		checkSameEdges(graph.buildUndirectedEdges(), expectedGraph.buildUndirectedEdges());
+		CHECK(graph.buildAdjacencyList() == expectedGraph.buildAdjacencyList());
+		graph.makeDirected();
+		expectedGraph.makeDirected();
+		CHECK(graph.buildAdjacencyList() == expectedGraph.buildAdjacencyList());
+		CHECK(graph.doesEdgeExist(4, 3));
+		CHECK_FALSE(graph.doesEdgeExist(5, 9));
+	}
+
 	SUBCASE("Reset") {
 		graph.reset();
 		CHECK_FALSE(graph.isDirected());
 		CHECK_FALSE(graph.isWeighted());
 		CHECK(graph.getNodes().empty());
-		CHECK(graph.getDirectedEdges().empty());
-		CHECK(graph.getUndirectedEdges().empty());
-		CHECK(graph.getAdjacencyList().empty());
+		CHECK(graph.buildDirectedEdges().empty());
+		CHECK(graph.buildUndirectedEdges().empty());
+		CHECK(graph.buildAdjacencyList().empty());
+		graph.makeDirected();
+		CHECK(graph.buildAdjacencyList().empty());
+	}
+
+	SUBCASE("Components") {
+		const int nodeC{ graph.createNode() };
+		const int nodeD{ graph.createNode() };
+		CHECK(graph.sameComponent(nodeA, nodeB));
+		CHECK_FALSE(graph.sameComponent(nodeB, nodeC));
+		CHECK(graph.getComponentId(nodeD) != graph.getComponentId(nodeC));
+		CHECK(graph.getComponentId(10) == -1);
+		CHECK_FALSE(graph.sameComponent(nodeA, 10));
+
+		// Edges join the components in both directed modes
 		graph.makeDirected();
-		CHECK(graph.getAdjacencyList().empty());
+		graph.addEdge(nodeD, nodeB);
+		CHECK(graph.sameComponent(nodeA, nodeD));
+		graph.addEdges({ Edge{ nodeC, nodeD } });
+		CHECK(graph.sameComponent(nodeC, nodeA));
+		CHECK(graph.getComponentId(nodeC) == graph.getComponentId(nodeA));
+
+		// Deleted edges split the components
+		graph.deleteEdge(nodeD, nodeB);
+		CHECK(graph.sameComponent(nodeA, nodeB));
+		CHECK(graph.sameComponent(nodeC, nodeD));
+		CHECK_FALSE(graph.sameComponent(nodeA, nodeD));
+
+		graph.addEdge(nodeB, nodeC);
+		CHECK(graph.sameComponent(nodeA, nodeD));
+		graph.deleteNode(nodeB);
+		CHECK_FALSE(graph.sameComponent(nodeA, nodeC));
+		CHECK(graph.sameComponent(nodeC, nodeD));
+
+		graph.reset();
+		const int nodeE{ graph.createNode() };
+		CHECK(graph.getComponentId(nodeE) != -1);
+	}
+
+	SUBCASE("Components after deletions") {
+		// Components kept up to date by the graph have to match the ones found from scratch after every deletion
+		std::mt19937 generator{ 1 };
+		graph.reset();
+		const int nodesCount{ 200 };
+		graph.createNodes(nodesCount);
+		std::uniform_int_distribution<int> nodeDistribution{ 1, nodesCount };
+		for (int i{ 0 }; i < 260; ++i) {
+			graph.addEdge(nodeDistribution(generator), nodeDistribution(generator));
+		}
+
+		for (int step{ 0 }; step < 200; ++step) {
+			if (step % 2 == 0) {
+				graph.makeDirected();
+			}
+			else {
+				graph.makeUndirected();
+			}
+			const std::vector<Edge> edges{ graph.buildEdges() };
+			if (step % 10 == 9) {
+				graph.deleteNode(graph.getNodes().getIds()[generator() % graph.getNodes().size()]);
+			}
+			else if (!edges.empty()) {
+				const Edge& edge{ edges[generator() % edges.size()] };
+				graph.deleteEdge(edge.a, edge.b);
+			}
+			else {
+				break;
+			}
+
+			const std::vector<int>& nodesIds{ graph.getNodes().getSortedIds() };
+			const GraphAlgorithms::ConnectedComponents expectedComponents{ GraphAlgorithms::connectedComponents(graph) };
+			for (std::size_t i{ 0 }; i + 1 < nodesIds.size(); ++i) {
+				const int j{ static_cast<int>(generator() % nodesIds.size()) };
+				CHECK(graph.sameComponent(nodesIds[i], nodesIds[j])
+					== (expectedComponents.componentsIdxs[i] == expectedComponents.componentsIdxs[j]));
+				CHECK(graph.sameComponent(nodesIds[i], nodesIds[i + 1])
+					== (expectedComponents.componentsIdxs[i] == expectedComponents.componentsIdxs[i + 1]));
+			}
+		}
+	}
+
+	SUBCASE("Memory usage") {
+		CountingMemoryResource upstream;
+		Graph pooledGraph{ &upstream };
+		pooledGraph.createNodes(100);
+		for (int i{ 1 }; i < 100; ++i) {
+			pooledGraph.addEdge(i, i + 1);
+		}
+
+		const Graph::MemoryUsage usage{ pooledGraph.getMemoryUsage() };
+		CHECK(usage.usedBytes > 0);
+		CHECK(usage.reservedBytes >= usage.usedBytes);
+		CHECK(upstream.getAllocatedBytes() == usage.reservedBytes);
+		CHECK(usage.unpooledBytes >= 100 * 3 * sizeof(int));
+
+		// Snapshot stores at least the offsets and the neighbors of every node
+		pooledGraph.snapshot();
+		CHECK(pooledGraph.getMemoryUsage().unpooledBytes >= usage.unpooledBytes + (101 + 2 * 99) * sizeof(int));
+
+		pooledGraph.reset();
+		CHECK(pooledGraph.getMemoryUsage().usedBytes == 0);
+		CHECK(pooledGraph.getMemoryUsage().reservedBytes == 0);
+		CHECK(upstream.getAllocatedBytes() == 0);
+		CHECK(upstream.getPeakAllocatedBytes() >= usage.reservedBytes);
 	}
 }
\ No newline at end of file
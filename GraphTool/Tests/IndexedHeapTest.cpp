@@ -0,0 +1,45 @@
+#include "../3rdParty/doctest.h"
+#include "../Include/IndexedHeap.hpp"
+
+TEST_CASE("Indexed Heap") {
+	IndexedHeap<int> heap{ 10 };
+	CHECK(heap.empty());
+
+	SUBCASE("Push and pop") {
+		for (const int element : { 4, 7, 1, 9, 0, 3 }) {
+			CHECK(heap.pushOrDecreaseKey(element, (element * 7) % 10));
+		}
+		CHECK(heap.size() == 6);
+		CHECK(heap.contains(9));
+		CHECK_FALSE(heap.contains(2));
+		CHECK(heap.getKey(4) == 8);
+
+		std::vector<int> poppedElements;
+		while (!heap.empty()) {
+			poppedElements.push_back(heap.pop());
+		}
+		CHECK(poppedElements == std::vector<int>{ 0, 3, 9, 1, 4, 7 });
+		CHECK_FALSE(heap.contains(0));
+	}
+
+	SUBCASE("Decrease key") {
+		heap.pushOrDecreaseKey(1, 10);
+		heap.pushOrDecreaseKey(2, 20);
+		heap.pushOrDecreaseKey(3, 30);
+		CHECK_FALSE(heap.pushOrDecreaseKey(2, 25));
+		CHECK(heap.getKey(2) == 20);
+		CHECK(heap.pushOrDecreaseKey(3, 5));
+		CHECK(heap.top() == 3);
+		CHECK(heap.topKey() == 5);
+		CHECK(heap.pop() == 3);
+		CHECK(heap.pop() == 1);
+		CHECK(heap.pop() == 2);
+	}
+
+	SUBCASE("Reset") {
+		heap.pushOrDecreaseKey(5, 1);
+		heap.reset(3);
+		CHECK(heap.empty());
+		CHECK_FALSE(heap.contains(2));
+	}
+}
@@ -0,0 +1,53 @@
+#include "../3rdParty/doctest.h"
+#include "../Include/NodeIndex.hpp"
+
+TEST_CASE("Node Index") {
+	NodeIndex nodeIndex;
+	CHECK(nodeIndex.insert(3) == 0);
+	CHECK(nodeIndex.insert(1) == 1);
+	CHECK(nodeIndex.insert(7) == 2);
+
+	SUBCASE("Lookup") {
+		CHECK(nodeIndex.size() == 3);
+		CHECK(nodeIndex.contains(1));
+		CHECK_FALSE(nodeIndex.contains(2));
+		CHECK_FALSE(nodeIndex.contains(-1));
+		CHECK_FALSE(nodeIndex.contains(100));
+		CHECK(nodeIndex.getIdx(7) == 2);
+		CHECK(nodeIndex.getId(1) == 1);
+		CHECK(nodeIndex.insert(3) == 0);
+		CHECK(nodeIndex.size() == 3);
+	}
+
+	SUBCASE("Erase keeps dense indices contiguous") {
+		nodeIndex.erase(3);
+		CHECK(nodeIndex.size() == 2);
+		CHECK_FALSE(nodeIndex.contains(3));
+		CHECK(nodeIndex.getIdx(7) == 0);
+		CHECK(nodeIndex.getIdx(1) == 1);
+		CHECK(nodeIndex.getId(0) == 7);
+	}
+
+	SUBCASE("Sorted ids") {
+		CHECK(nodeIndex.getSortedIds() == std::vector<int>{ 1, 3, 7 });
+		nodeIndex.insert(5);
+		nodeIndex.insert(9);
+		nodeIndex.erase(3);
+		CHECK(nodeIndex.getSortedIds() == std::vector<int>{ 1, 5, 7, 9 });
+	}
+
+	SUBCASE("Handles") {
+		const NodeIndex::Handle handle{ nodeIndex.getHandle(1) };
+		CHECK(nodeIndex.isValid(handle));
+		nodeIndex.erase(1);
+		CHECK_FALSE(nodeIndex.isValid(handle));
+		nodeIndex.insert(1);
+		CHECK_FALSE(nodeIndex.isValid(handle));
+		CHECK(nodeIndex.isValid(nodeIndex.getHandle(1)));
+
+		const NodeIndex::Handle handle2{ nodeIndex.getHandle(7) };
+		nodeIndex.clear();
+		CHECK(nodeIndex.empty());
+		CHECK_FALSE(nodeIndex.isValid(handle2));
+	}
+}
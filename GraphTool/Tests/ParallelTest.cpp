@@ -0,0 +1,60 @@
+#include "../3rdParty/doctest.h"
+#include "../Include/Parallel.hpp"
+#include <vector>
+#include <atomic>
+#include <thread>
+
+TEST_CASE("Parallel for") {
+	const int itemsCount{ 10000 };
+	std::vector<std::atomic<int>> visitsCounts(itemsCount);
+	auto countVisits = [&visitsCounts](int chunkBegin, int chunkEnd, int) {
+		for (int item{ chunkBegin }; item < chunkEnd; ++item) {
+			++visitsCounts[item];
+		}
+	};
+	auto checkVisitedOnce = [&visitsCounts]() {
+		for (std::atomic<int>& visitsCount : visitsCounts) {
+			CHECK(visitsCount.exchange(0) == 1);
+		}
+	};
+
+	SUBCASE("Every item once") {
+		// Repeated calls reuse the same worker threads
+		for (const int threadsCount : { 1, 4, 3, 8 }) {
+			Parallel::parallelFor(0, itemsCount, countVisits, threadsCount, 100);
+			checkVisitedOnce();
+		}
+	}
+
+	SUBCASE("Chunk indices") {
+		std::vector<std::atomic<int>> chunksVisitsCounts(4);
+		Parallel::parallelFor(0, itemsCount, [&chunksVisitsCounts](int, int, int chunkIdx) {
+			++chunksVisitsCounts[chunkIdx];
+			}, 4, 100);
+		for (std::atomic<int>& chunkVisitsCount : chunksVisitsCounts) {
+			CHECK(chunkVisitsCount == 1);
+		}
+	}
+
+	SUBCASE("Small range") {
+		// Single chunk runs on the calling thread
+		const std::thread::id callingThreadId{ std::this_thread::get_id() };
+		Parallel::parallelFor(0, 10, [&callingThreadId](int chunkBegin, int chunkEnd, int chunkIdx) {
+			const bool isCallingThread{ std::this_thread::get_id() == callingThreadId };
+			CHECK(isCallingThread);
+			CHECK(chunkBegin == 0);
+			CHECK(chunkEnd == 10);
+			CHECK(chunkIdx == 0);
+			}, 8);
+	}
+
+	SUBCASE("Nested") {
+		// Pool is busy with the outer call, so the inner calls run on their own threads
+		Parallel::parallelFor(0, 4, [&](int chunkBegin, int chunkEnd, int) {
+			for (int part{ chunkBegin }; part < chunkEnd; ++part) {
+				Parallel::parallelFor(part * itemsCount / 4, (part + 1) * itemsCount / 4, countVisits, 4, 100);
+			}
+			}, 4, 1);
+		checkVisitedOnce();
+	}
+}
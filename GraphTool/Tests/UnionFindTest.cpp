@@ -0,0 +1,48 @@
+#include "../3rdParty/doctest.h"
+#include "../Include/UnionFind.hpp"
+
+TEST_CASE("Union Find") {
+	UnionFind unionFind{ 6 };
+	CHECK(unionFind.size() == 6);
+	CHECK(unionFind.getSetsCount() == 6);
+
+	SUBCASE("Unite") {
+		CHECK(unionFind.unite(0, 1));
+		CHECK(unionFind.unite(2, 3));
+		CHECK(unionFind.unite(1, 3));
+		CHECK_FALSE(unionFind.unite(0, 2));
+		CHECK(unionFind.getSetsCount() == 3);
+
+		CHECK(unionFind.isSameSet(0, 3));
+		CHECK(unionFind.find(2) == unionFind.find(1));
+		CHECK_FALSE(unionFind.isSameSet(0, 4));
+		CHECK_FALSE(unionFind.isSameSet(4, 5));
+	}
+
+	SUBCASE("Union by rank") {
+		// Smaller tree is attached under the root of the larger one
+		unionFind.unite(0, 1);
+		const int root{ unionFind.find(0) };
+		unionFind.unite(2, 0);
+		CHECK(unionFind.find(2) == root);
+		CHECK(std::as_const(unionFind).getRoot(2) == root);
+	}
+
+	SUBCASE("Grow") {
+		unionFind.unite(0, 5);
+		unionFind.grow(8);
+		CHECK(unionFind.size() == 8);
+		CHECK(unionFind.getSetsCount() == 7);
+		CHECK(unionFind.unite(7, 5));
+		CHECK(unionFind.isSameSet(0, 7));
+		CHECK(unionFind.find(6) == 6);
+	}
+
+	SUBCASE("Reset") {
+		unionFind.unite(0, 1);
+		unionFind.reset(3);
+		CHECK(unionFind.size() == 3);
+		CHECK(unionFind.getSetsCount() == 3);
+		CHECK_FALSE(unionFind.isSameSet(0, 1));
+	}
+}
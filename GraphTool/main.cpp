@@ -1,14 +1,16 @@
 #include "Include/Application.hpp"
 
-#if defined(_DEBUG)
+// Define GRAPHTOOL_BENCHMARKS to run tests and benchmarks in release builds
+#if defined(_DEBUG) || defined(GRAPHTOOL_BENCHMARKS)
 #define DOCTEST_CONFIG_IMPLEMENT
 #include "3rdParty/doctest.h"
 #endif
 
-int main()
+int main(int argc, char** argv)
 {
-#if defined(_DEBUG)
+#if defined(_DEBUG) || defined(GRAPHTOOL_BENCHMARKS)
 	doctest::Context context;
+	context.applyCommandLine(argc, argv);
 	const int testResult{ context.run() };
 	if (context.shouldExit()) {
 		return testResult;